@@ -0,0 +1,10 @@
+// Personal Libraries
+#include "HexBenchmark.hpp"
+
+std::vector<qreal> HexNormalisedInfo::Coefficients = { };
+
+int main(void)
+{
+	HexBenchmark::Kernels();
+	return (HexBenchmark::ChartParser() ? 0 : 1);
+}
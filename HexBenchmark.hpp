@@ -0,0 +1,394 @@
+#ifndef __BENCHMARK_HPP__
+#define __BENCHMARK_HPP__
+
+// Qt Libraries
+#include <QElapsedTimer>
+#include <QImage>
+#include <QTransform>
+
+// Standard Libraries
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+
+// Personal Libraries
+#include "HexChartScanner.hpp"
+#include "OtherClasses.hpp"
+
+class HexBenchmark
+{
+	private:
+	
+		static constexpr qint32						ChartWidth = 451;
+		static constexpr qint32						ChartHeight = 865;
+		static constexpr quint32					Frames = 16u;
+		static constexpr quint32					Rounds = 5u;
+		static constexpr quint32					SessionLength = 23'400u;
+		
+		inline static QImage						MakeChart(std::mt19937&, qint32);
+		inline static std::vector<HexCandlestick<qreal>>		MakeSession(void);
+		template<class Kernel> inline static qreal			Normalise(const std::vector<HexCandlestick<qreal>>&, quint32, std::vector<HexNormalisedInfo>&);
+		inline static std::vector<HexCandlestick<qreal>>		ParseRotated(const QImage&);
+		inline static std::vector<HexCandlestick<qreal>>		ParseScanlines(const QImage&, std::vector<qint32>&, std::vector<qint32>&);
+		inline static qreal						Quarter(qreal);
+		template<class Kernel> inline static qreal			Scan(const std::vector<HexNormalisedInfo>&, bool, qreal&);
+	
+	public:
+	
+		inline static bool						ChartParser(void);
+		inline static void						Kernels(void);
+};
+
+// Synthetic charts at the feed's grab size are parsed by the scanline parser and by the former
+// rotate-and-walk one; both must read the same candlesticks before their timings mean anything.
+bool HexBenchmark::ChartParser(void)
+{
+	std::mt19937 generator(20'260'102u);
+	std::vector<QImage> charts;
+	
+	for (auto i = 0u; i < HexBenchmark::Frames; ++i)
+		charts.push_back(HexBenchmark::MakeChart(generator, 300 + 8*static_cast<qint32>(i)));
+	
+	std::vector<qint32> tops;
+	std::vector<qint32> bottoms;
+	auto numberOfCandlesticks = 0u;
+	auto numberOfMismatches = 0u;
+	
+	for (const auto& chart : charts)
+	{
+		const auto rotated = HexBenchmark::ParseRotated(chart);
+		const auto scanned = HexBenchmark::ParseScanlines(chart, tops, bottoms);
+		numberOfCandlesticks += static_cast<quint32>(rotated.size());
+		
+		if (rotated.size() != scanned.size())
+		{
+			++numberOfMismatches;
+			continue;
+		}
+		
+		for (auto i = 0u; i < rotated.size(); ++i)
+		{
+			if (rotated[i].low != scanned[i].low or rotated[i].high != scanned[i].high)
+				++numberOfMismatches;
+		}
+	}
+	
+	auto rotatedTime = std::numeric_limits<qint64>::max();
+	auto scannedTime = std::numeric_limits<qint64>::max();
+	auto checksum = 0u;
+	
+	for (auto round = 0u; round < HexBenchmark::Rounds; ++round)
+	{
+		QElapsedTimer timer;
+		timer.start();
+		
+		for (const auto& chart : charts)
+			checksum += static_cast<quint32>(HexBenchmark::ParseRotated(chart).size());
+		
+		rotatedTime = std::min(timer.nsecsElapsed(), rotatedTime);
+		timer.start();
+		
+		for (const auto& chart : charts)
+			checksum += static_cast<quint32>(HexBenchmark::ParseScanlines(chart, tops, bottoms).size());
+		
+		scannedTime = std::min(timer.nsecsElapsed(), scannedTime);
+	}
+	
+	const auto frames = static_cast<qreal>(HexBenchmark::Frames);
+	
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << " >> Chart parser parity over " << HexBenchmark::Frames << " frames and " << numberOfCandlesticks << " candlesticks: " << numberOfMismatches << " mismatches." << std::endl;
+	std::cout << " >> Rotate and walk: " << static_cast<qreal>(rotatedTime)/frames/1'000. << " us per frame." << std::endl;
+	std::cout << " >> Scanlines: " << static_cast<qreal>(scannedTime)/frames/1'000. << " us per frame (x" << static_cast<qreal>(rotatedTime)/static_cast<qreal>(std::max(scannedTime, static_cast<qint64>(1))) << ")." << std::endl;
+	std::cout << " >> Checksum " << checksum << '.' << std::endl;
+	
+	return (numberOfMismatches == 0u);
+}
+
+// Every specialised length is timed against the generic loop on the same synthetic session, weighted or not:
+// per window normalisation, then the straight and the nemesis scans over all windows.
+void HexBenchmark::Kernels(void)
+{
+	const auto session = HexBenchmark::MakeSession();
+	auto checksum = 0.;
+	
+	std::cout << std::fixed << std::setprecision(2);
+	
+	for (const auto firstCoefficient : { 1., 0.5 })
+	{
+		for (const auto numberOfCandlesticks : HexKernelSwitch::SpecialisedLengths)
+		{
+			HexNormalisedInfo::UpdateCoefficients(firstCoefficient, numberOfCandlesticks);
+			std::cout << " >> " << numberOfCandlesticks << " candlesticks" << (firstCoefficient != 1. ? ", weighted" : "") << ", ns per window:" << std::endl;
+			std::cout << "    " << std::setw(12) << std::left << "Kernel" << std::right << std::setw(18) << "Normalise" << std::setw(18) << "Straight" << std::setw(18) << "Nemesis" << std::endl;
+			
+			std::vector<HexNormalisedInfo> windows;
+			std::array<qreal, 3u> generic = { 0., 0., 0. };
+			
+			for (const auto strategy : { KernelEnum::Generic, KernelEnum::Specialised, KernelEnum::Paired })
+			{
+				HexKernelSwitch::Dispatch(numberOfCandlesticks, strategy, [&](auto kernel)
+				{
+					using Kernel = decltype(kernel);
+					
+					const std::array<qreal, 3u> times = { HexBenchmark::Normalise<Kernel>(session, numberOfCandlesticks, windows), HexBenchmark::Scan<Kernel>(windows, false, checksum), HexBenchmark::Scan<Kernel>(windows, true, checksum) };
+					
+					if (strategy == KernelEnum::Generic)
+						generic = times;
+					
+					std::cout << "    " << std::setw(12) << std::left << HexKernelSwitch::Name(strategy).toStdString() << std::right;
+					
+					for (auto i = 0u; i < times.size(); ++i)
+						std::cout << std::setw(10) << times[i] << " (x" << generic[i]/std::max(times[i], 0.01) << ')';
+					
+					std::cout << std::endl;
+				});
+			}
+		}
+	}
+	
+	std::cout << " >> Checksum " << checksum << '.' << std::endl;
+}
+
+// A white chart whose gray column sits right after the last candlestick, with its grid bars beyond it.
+// Each column is a candlestick drawn blue above and red below a random split, either part may be missing.
+QImage HexBenchmark::MakeChart(std::mt19937& generator, qint32 realWidth)
+{
+	QImage chart(HexBenchmark::ChartWidth, HexBenchmark::ChartHeight, QImage::Format_RGB32);
+	chart.fill(0xFF'FF'FF'FFu);
+	
+	std::uniform_int_distribution<qint32> step(-6, 6);
+	std::uniform_int_distribution<qint32> body(0, 24);
+	std::uniform_int_distribution<qint32> split(0, 100);
+	auto middle = HexBenchmark::ChartHeight/2;
+	
+	for (auto y = 0; y < HexBenchmark::ChartHeight; ++y)
+	{
+		const auto line = reinterpret_cast<quint32*>(chart.scanLine(y));
+		line[realWidth] = HexChartScanner::GrayColor;
+		
+		if (y%80 == 40)
+			std::fill(line + realWidth + 1, line + HexBenchmark::ChartWidth, HexChartScanner::GrayColor);
+	}
+	
+	for (auto x = 0; x < realWidth; ++x)
+	{
+		middle = std::clamp(middle + step(generator), 60, HexBenchmark::ChartHeight - 60);
+		const auto top = middle - body(generator);
+		const auto bottom = middle + body(generator);
+		const auto red = top + split(generator)*(bottom - top + 1)/100;
+		
+		for (auto y = top; y <= bottom; ++y)
+			reinterpret_cast<quint32*>(chart.scanLine(y))[x] = (y < red ? HexChartScanner::BlueColor : HexChartScanner::RedColor);
+	}
+	
+	return chart;
+}
+
+// A reproducible random walk, quoted in quarters like the charts we feed on.
+std::vector<HexCandlestick<qreal>> HexBenchmark::MakeSession(void)
+{
+	std::mt19937 generator(20'260'101u);
+	std::uniform_int_distribution<qint32> step(-4, 4);
+	std::uniform_int_distribution<qint32> range(0, 6);
+	
+	std::vector<HexCandlestick<qreal>> session;
+	session.reserve(HexBenchmark::SessionLength);
+	auto price = 20'000.;
+	
+	for (auto i = 0u; i < HexBenchmark::SessionLength; ++i)
+	{
+		price += 0.25*static_cast<qreal>(step(generator));
+		session.emplace_back(price, price + 0.25*static_cast<qreal>(range(generator)));
+	}
+	
+	return session;
+}
+
+template<class Kernel>
+qreal HexBenchmark::Normalise(const std::vector<HexCandlestick<qreal>>& session, quint32 numberOfCandlesticks, std::vector<HexNormalisedInfo>& windows)
+{
+	const auto numberOfWindows = static_cast<quint32>(session.size()) - numberOfCandlesticks + 1u;
+	auto bestTime = std::numeric_limits<qint64>::max();
+	
+	for (auto round = 0u; round < HexBenchmark::Rounds; ++round)
+	{
+		windows.clear();
+		windows.reserve(numberOfWindows);
+		
+		QElapsedTimer timer;
+		timer.start();
+		
+		for (auto i = 0u; i < numberOfWindows; ++i)
+			windows.emplace_back(Kernel(), session.cbegin() + i, 1u, numberOfCandlesticks);
+		
+		bestTime = std::min(timer.nsecsElapsed(), bestTime);
+	}
+	
+	return static_cast<qreal>(bestTime)/static_cast<qreal>(numberOfWindows);
+}
+
+// The parser QFeedingThread used before scanlines: copy, rotate by 90 degrees, then walk every rotated line.
+std::vector<HexCandlestick<qreal>> HexBenchmark::ParseRotated(const QImage& img)
+{
+	auto it = reinterpret_cast<const quint32*>(img.constScanLine(0));
+	auto realWidth = 0;
+	
+	while (*it != HexChartScanner::GrayColor and realWidth < HexBenchmark::ChartWidth)
+	{
+		++it;
+		++realWidth;
+	}
+	
+	const auto realImage = img.copy(0, 0, realWidth + 2, HexBenchmark::ChartHeight).transformed(QTransform().rotate(90.f));
+	auto pixelIt = reinterpret_cast<const quint32*>(realImage.constScanLine(realWidth + 1));
+	
+	auto numberOfGrayBars = 0u;
+	auto pMin = 0;
+	auto pMax = 0;
+	
+	for (auto pixelCount = 0; pixelCount < HexBenchmark::ChartHeight; ++pixelCount)
+	{
+		if (*pixelIt == HexChartScanner::GrayColor)
+		{
+			if (numberOfGrayBars == 0u)
+				pMin = pixelCount;
+			
+			pMax = pixelCount;
+			++numberOfGrayBars;
+		}
+		
+		++pixelIt;
+	}
+	
+	std::vector<HexCandlestick<qreal>> pixelCandlesticks;
+	
+	if (numberOfGrayBars < 2u)
+		return pixelCandlesticks;
+	
+	const auto coeff = static_cast<qreal>(numberOfGrayBars - 1u)/static_cast<qreal>(pMax - pMin);
+	pixelCandlesticks.reserve(500u);
+	
+	for (auto lineCount = 0; lineCount < realWidth; ++lineCount)
+	{
+		auto pxIt = reinterpret_cast<const quint32*>(realImage.constScanLine(lineCount));
+		auto min = -1000.;
+		auto max = -1000.;
+		
+		for (auto pixelCount = 0; pixelCount < HexBenchmark::ChartHeight; ++pixelCount)
+		{
+			switch (*pxIt)
+			{
+				case HexChartScanner::BlueColor:
+				{
+					max = coeff*static_cast<qreal>(pixelCount - pMin);
+					break;
+				}
+				
+				case HexChartScanner::RedColor:
+				{
+					if (min == -1000.)
+						min = coeff*static_cast<qreal>(pixelCount - pMin);
+					
+					break;
+				}
+				
+				default:
+					break;
+			}
+			
+			++pxIt;
+		}
+		
+		if (max != -1000.)
+		{
+			if (min == -1000.)
+				min = max;
+			
+			pixelCandlesticks.emplace_back(HexBenchmark::Quarter(min), HexBenchmark::Quarter(max));
+		}
+	}
+	
+	return pixelCandlesticks;
+}
+
+// The same steps as QFeedingThread::parseChart and updateCandlesticks, on the original scanlines.
+std::vector<HexCandlestick<qreal>> HexBenchmark::ParseScanlines(const QImage& img, std::vector<qint32>& blueTops, std::vector<qint32>& redBottoms)
+{
+	std::vector<HexCandlestick<qreal>> pixelCandlesticks;
+	const auto realWidth = HexChartScanner::FindColor(reinterpret_cast<const quint32*>(img.constScanLine(0)), HexBenchmark::ChartWidth, HexChartScanner::GrayColor);
+	
+	if (realWidth + 1 >= HexBenchmark::ChartWidth)
+		return pixelCandlesticks;
+	
+	auto top = 0;
+	auto bottom = 0;
+	const auto numberOfGrayBars = HexChartScanner::CountGrayBars(img, realWidth + 1, HexBenchmark::ChartHeight, top, bottom);
+	
+	if (numberOfGrayBars < 2u)
+		return pixelCandlesticks;
+	
+	blueTops.assign(realWidth, -1);
+	redBottoms.assign(realWidth, -1);
+	
+	for (auto y = 0; y < HexBenchmark::ChartHeight; ++y)
+		HexChartScanner::ScanLine(reinterpret_cast<const quint32*>(img.constScanLine(y)), realWidth, y, blueTops.data(), redBottoms.data());
+	
+	const auto coeff = static_cast<qreal>(numberOfGrayBars - 1u)/static_cast<qreal>(bottom - top);
+	pixelCandlesticks.reserve(500u);
+	
+	for (auto x = 0; x < realWidth; ++x)
+	{
+		if (blueTops[x] < 0)
+			continue;
+		
+		const auto max = coeff*static_cast<qreal>(bottom - blueTops[x]);
+		const auto min = (redBottoms[x] < 0 ? max : coeff*static_cast<qreal>(bottom - redBottoms[x]));
+		pixelCandlesticks.emplace_back(HexBenchmark::Quarter(min), HexBenchmark::Quarter(max));
+	}
+	
+	return pixelCandlesticks;
+}
+
+qreal HexBenchmark::Quarter(qreal value)
+{
+	const auto rounded = (static_cast<qint64>(value*100. + 12.5)/25LL)*25LL;
+	return static_cast<qreal>(rounded)/100.;
+}
+
+template<class Kernel>
+qreal HexBenchmark::Scan(const std::vector<HexNormalisedInfo>& windows, bool nemesis, qreal& checksum)
+{
+	const auto& straightPattern = windows[windows.size()/2u];
+	const auto reversedPattern = HexNormalisedInfo::Reversed(straightPattern);
+	auto bestTime = std::numeric_limits<qint64>::max();
+	
+	for (auto round = 0u; round < HexBenchmark::Rounds; ++round)
+	{
+		QElapsedTimer timer;
+		timer.start();
+		auto foo = 0.;
+		
+		if (nemesis)
+		{
+			for (const auto& window : windows)
+			{
+				const auto [scalar1, scalar2] = straightPattern.scalars<Kernel>(reversedPattern, window);
+				foo += std::max(scalar1, scalar2);
+			}
+		}
+		else
+		{
+			for (const auto& window : windows)
+				foo += straightPattern.scalar<Kernel>(window);
+		}
+		
+		bestTime = std::min(timer.nsecsElapsed(), bestTime);
+		checksum += foo;
+	}
+	
+	return static_cast<qreal>(bestTime)/static_cast<qreal>(windows.size());
+}
+
+#endif
@@ -0,0 +1,237 @@
+#ifndef __CANDLE_SOURCE_HPP__
+#define __CANDLE_SOURCE_HPP__
+
+// Qt Libraries
+#include <QFile>
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QThread>
+
+// Standard Libraries
+#include <cstring>
+#include <iostream>
+
+// Personal Libraries
+#include "OtherClasses.hpp"
+
+class HexCandleSource
+{
+	protected:
+	
+		QByteArray							pending;
+		quint32								numberOfRestarts = 0u;
+		
+		inline bool							parseLines(std::vector<HexCandlestick<qreal>>&);
+		inline void							restart(std::vector<HexCandlestick<qreal>>&);
+	
+	public:
+	
+		virtual								~HexCandleSource(void) = default;
+		virtual void							close(void) = 0;
+		virtual bool							open(void) = 0;
+		virtual bool							read(std::vector<HexCandlestick<qreal>>&, qint32) = 0;
+		inline quint32							restarts(void) const;
+};
+
+class HexFileSource : public HexCandleSource
+{
+	private:
+	
+		static constexpr qint64						RecordSize = 2*sizeof(qreal);
+		
+		QFile								file;
+		qint64								offset = 0;
+		bool								binary = false;
+		
+		inline bool							parseRecords(std::vector<HexCandlestick<qreal>>&);
+	
+	public:
+	
+		inline								HexFileSource(const QString&);
+		inline void							close(void) override;
+		inline bool							open(void) override;
+		inline bool							read(std::vector<HexCandlestick<qreal>>&, qint32) override;
+};
+
+class HexSocketSource : public HexCandleSource
+{
+	private:
+	
+		QString								name;
+		QLocalServer*							server = nullptr;
+		QLocalSocket*							socket = nullptr;
+	
+	public:
+	
+		inline								HexSocketSource(const QString&);
+		inline								~HexSocketSource(void) override;
+		inline void							close(void) override;
+		inline bool							open(void) override;
+		inline bool							read(std::vector<HexCandlestick<qreal>>&, qint32) override;
+};
+
+bool HexCandleSource::parseLines(std::vector<HexCandlestick<qreal>>& candlesticks)
+{
+	auto somethingNew = false;
+	auto end = HexCandleSource::pending.indexOf('\n');
+	
+	while (end >= 0)
+	{
+		const auto numbers = QString::fromUtf8(HexCandleSource::pending.constData(), end).trimmed().split(' ');
+		HexCandleSource::pending.remove(0, end + 1);
+		end = HexCandleSource::pending.indexOf('\n');
+		
+		if (numbers.size() != 2u)
+			continue;
+		
+		candlesticks.emplace_back(numbers[0u].toDouble(), numbers[1u].toDouble());
+		somethingNew = true;
+	}
+	
+	return somethingNew;
+}
+
+void HexCandleSource::restart(std::vector<HexCandlestick<qreal>>& candlesticks)
+{
+	HexCandleSource::pending.clear();
+	candlesticks.clear();
+	++HexCandleSource::numberOfRestarts;
+}
+
+quint32 HexCandleSource::restarts(void) const
+{
+	return HexCandleSource::numberOfRestarts;
+}
+
+HexFileSource::HexFileSource(const QString& path) :
+	file(path),
+	binary(path.endsWith(".bin"))
+{
+}
+
+void HexFileSource::close(void)
+{
+	HexFileSource::file.close();
+}
+
+bool HexFileSource::open(void)
+{
+	HexFileSource::offset = 0;
+	HexCandleSource::pending.clear();
+	
+	if (not HexFileSource::file.open(QIODevice::ReadOnly))
+	{
+		std::cout << "Could not open feed file [" << HexFileSource::file.fileName().toStdString() << "]." << std::endl;
+		return false;
+	}
+	
+	return true;
+}
+
+bool HexFileSource::parseRecords(std::vector<HexCandlestick<qreal>>& candlesticks)
+{
+	const auto numberOfRecords = HexCandleSource::pending.size()/HexFileSource::RecordSize;
+	auto it = HexCandleSource::pending.constData();
+	
+	for (auto i = 0; i < numberOfRecords; ++i)
+	{
+		qreal values[2u];
+		std::memcpy(values, it, HexFileSource::RecordSize);
+		candlesticks.emplace_back(values[0u], values[1u]);
+		it += HexFileSource::RecordSize;
+	}
+	
+	HexCandleSource::pending.remove(0, numberOfRecords*HexFileSource::RecordSize);
+	return (numberOfRecords != 0);
+}
+
+bool HexFileSource::read(std::vector<HexCandlestick<qreal>>& candlesticks, qint32 timeout)
+{
+	const auto size = HexFileSource::file.size();
+	
+	if (size < HexFileSource::offset)
+	{
+		HexFileSource::offset = 0;
+		HexCandleSource::restart(candlesticks);
+	}
+	
+	if (size == HexFileSource::offset)
+	{
+		QThread::msleep(timeout);
+		return false;
+	}
+	
+	HexFileSource::file.seek(HexFileSource::offset);
+	HexCandleSource::pending.append(HexFileSource::file.readAll());
+	HexFileSource::offset = HexFileSource::file.pos();
+	
+	return (HexFileSource::binary ? HexFileSource::parseRecords(candlesticks) : HexCandleSource::parseLines(candlesticks));
+}
+
+HexSocketSource::HexSocketSource(const QString& serverName) :
+	name(serverName)
+{
+}
+
+HexSocketSource::~HexSocketSource(void)
+{
+	HexSocketSource::close();
+}
+
+void HexSocketSource::close(void)
+{
+	delete HexSocketSource::socket;
+	HexSocketSource::socket = nullptr;
+	
+	if (HexSocketSource::server != nullptr)
+		HexSocketSource::server->close();
+	
+	delete HexSocketSource::server;
+	HexSocketSource::server = nullptr;
+}
+
+bool HexSocketSource::open(void)
+{
+	HexSocketSource::close();
+	HexCandleSource::pending.clear();
+	QLocalServer::removeServer(HexSocketSource::name);
+	HexSocketSource::server = new QLocalServer();
+	
+	if (not HexSocketSource::server->listen(HexSocketSource::name))
+	{
+		std::cout << "Could not listen on [" << HexSocketSource::name.toStdString() << "]." << std::endl;
+		return false;
+	}
+	
+	std::cout << "Listening on [" << HexSocketSource::name.toStdString() << "]." << std::endl;
+	return true;
+}
+
+bool HexSocketSource::read(std::vector<HexCandlestick<qreal>>& candlesticks, qint32 timeout)
+{
+	if (HexSocketSource::socket == nullptr)
+	{
+		if (HexSocketSource::server->waitForNewConnection(timeout))
+		{
+			HexSocketSource::socket = HexSocketSource::server->nextPendingConnection();
+			HexCandleSource::restart(candlesticks);
+		}
+		
+		return false;
+	}
+	
+	if (HexSocketSource::socket->state() != QLocalSocket::ConnectedState and HexSocketSource::socket->bytesAvailable() == 0)
+	{
+		delete HexSocketSource::socket;
+		HexSocketSource::socket = nullptr;
+		return false;
+	}
+	
+	if (HexSocketSource::socket->bytesAvailable() == 0 and not HexSocketSource::socket->waitForReadyRead(timeout))
+		return false;
+	
+	HexCandleSource::pending.append(HexSocketSource::socket->readAll());
+	return HexCandleSource::parseLines(candlesticks);
+}
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef __CAPTURE_SCHEDULER_HPP__
+#define __CAPTURE_SCHEDULER_HPP__
+
+// Qt Libraries
+#include <QtGlobal>
+
+// Standard Libraries
+#include <algorithm>
+#include <array>
+#include <iostream>
+
+class HexCaptureScheduler
+{
+	private:
+	
+		static constexpr quint32				BurstDelay = 2u;
+		static constexpr quint32				FixedDelay = 50u;
+		static constexpr qint64				RolloverWindow = 250;
+		static constexpr qreal					Smoothing = 0.2;
+		static constexpr std::array<qint64, 9u>		Buckets = { 1, 2, 5, 10, 20, 50, 100, 200, 500 };
+		
+		std::array<quint64, 10u>				histogram = {};
+		qint64							latestChange = -1;
+		qreal							averageInterval = 0.;
+		qint64							barLength = 1'000;
+		quint32							budget = 0u;
+	
+	public:
+	
+		inline quint32						delay(qint64, qint64, qint64);
+		inline void						record(qint64);
+		inline void						report(void) const;
+		inline void						setUp(quint32, quint32);
+};
+
+quint32 HexCaptureScheduler::delay(qint64 msecsFromRef, qint64 now, qint64 change)
+{
+	const auto changed = (change != HexCaptureScheduler::latestChange);
+	
+	if (changed)
+	{
+		if (HexCaptureScheduler::latestChange >= 0)
+		{
+			const auto interval = static_cast<qreal>(change - HexCaptureScheduler::latestChange)/1'000'000.;
+			HexCaptureScheduler::averageInterval += (HexCaptureScheduler::averageInterval == 0. ? interval : HexCaptureScheduler::Smoothing*(interval - HexCaptureScheduler::averageInterval));
+		}
+		
+		HexCaptureScheduler::latestChange = change;
+	}
+	
+	if (HexCaptureScheduler::budget == 0u)
+		return (changed ? 0u : HexCaptureScheduler::FixedDelay);
+	
+	if (changed)
+		return HexCaptureScheduler::BurstDelay;
+	
+	const auto window = std::min(HexCaptureScheduler::RolloverWindow, HexCaptureScheduler::barLength/8);
+	const auto phase = (msecsFromRef % HexCaptureScheduler::barLength + HexCaptureScheduler::barLength) % HexCaptureScheduler::barLength;
+	const auto toRollover = HexCaptureScheduler::barLength - phase;
+	
+	if (phase < window or toRollover <= window)
+		return HexCaptureScheduler::BurstDelay;
+	
+	const auto quiet = (HexCaptureScheduler::latestChange >= 0 ? static_cast<qreal>(now - HexCaptureScheduler::latestChange)/1'000'000. : 0.);
+	const auto relaxed = static_cast<qint64>(std::max(HexCaptureScheduler::averageInterval, quiet)/4.);
+	const auto bounded = std::clamp(relaxed, static_cast<qint64>(HexCaptureScheduler::BurstDelay), static_cast<qint64>(HexCaptureScheduler::budget));
+	
+	return static_cast<quint32>(std::max(std::min(bounded, toRollover - window), static_cast<qint64>(HexCaptureScheduler::BurstDelay)));
+}
+
+void HexCaptureScheduler::record(qint64 latency)
+{
+	const auto milliseconds = (latency + 999'999)/1'000'000;
+	auto bucket = 0u;
+	
+	while (bucket < HexCaptureScheduler::Buckets.size() and HexCaptureScheduler::Buckets[bucket] < milliseconds)
+		++bucket;
+	
+	++HexCaptureScheduler::histogram[bucket];
+}
+
+void HexCaptureScheduler::report(void) const
+{
+	if (HexCaptureScheduler::budget == 0u)
+		std::cout << " >> Detection latency with fixed " << HexCaptureScheduler::FixedDelay << " ms cadence:" << std::endl;
+	else
+		std::cout << " >> Detection latency with adaptive cadence (" << HexCaptureScheduler::budget << " ms budget):" << std::endl;
+	
+	for (auto i = 0u; i < HexCaptureScheduler::Buckets.size(); ++i)
+		std::cout << "    <= " << HexCaptureScheduler::Buckets[i] << " ms: " << HexCaptureScheduler::histogram[i] << std::endl;
+	
+	std::cout << "    > " << HexCaptureScheduler::Buckets.back() << " ms: " << HexCaptureScheduler::histogram.back() << std::endl;
+}
+
+void HexCaptureScheduler::setUp(quint32 latencyBudget, quint32 feedingTimeUnit)
+{
+	HexCaptureScheduler::histogram.fill(0u);
+	HexCaptureScheduler::latestChange = -1;
+	HexCaptureScheduler::averageInterval = 0.;
+	HexCaptureScheduler::barLength = 1'000*static_cast<qint64>(feedingTimeUnit);
+	HexCaptureScheduler::budget = (latencyBudget != 0u ? std::max(latencyBudget, HexCaptureScheduler::BurstDelay) : 0u);
+}
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef __CHART_SCANNER_HPP__
+#define __CHART_SCANNER_HPP__
+
+// Qt Libraries
+#include <QImage>
+
+// Standard Libraries
+#include <bit>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+class HexChartScanner
+{
+	public:
+	
+		static constexpr quint32				BlueColor = 4'284'914'175u;
+		static constexpr quint32				RedColor =  4'294'927'974u;
+		static constexpr quint32				GrayColor = 4'285'893'782u;
+		
+		inline static quint32					CountGrayBars(const QImage&, qint32, qint32, qint32&, qint32&);
+		inline static qint32					FindColor(const quint32*, qint32, quint32);
+		inline static void					ScanLine(const quint32*, qint32, qint32, qint32*, qint32*);
+};
+
+quint32 HexChartScanner::CountGrayBars(const QImage& img, qint32 column, qint32 height, qint32& top, qint32& bottom)
+{
+	auto numberOfGrayBars = 0u;
+	
+	for (auto y = 0; y < height; ++y)
+	{
+		if (reinterpret_cast<const quint32*>(img.constScanLine(y))[column] == HexChartScanner::GrayColor)
+		{
+			if (numberOfGrayBars == 0u)
+				top = y;
+			
+			bottom = y;
+			++numberOfGrayBars;
+		}
+	}
+	
+	return numberOfGrayBars;
+}
+
+qint32 HexChartScanner::FindColor(const quint32* line, qint32 width, quint32 color)
+{
+	auto x = 0;
+
+#if defined(__SSE2__)
+	const auto target = _mm_set1_epi32(static_cast<qint32>(color));
+	
+	for (; x + 4 <= width; x += 4)
+	{
+		const auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(line + x));
+		const auto mask = static_cast<quint32>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(pixels, target))));
+		
+		if (mask != 0u)
+			return x + std::countr_zero(mask);
+	}
+#endif
+
+	while (x < width and line[x] != color)
+		++x;
+	
+	return x;
+}
+
+void HexChartScanner::ScanLine(const quint32* line, qint32 width, qint32 y, qint32* tops, qint32* bottoms)
+{
+	auto x = 0;
+
+#if defined(__SSE2__)
+	const auto blue = _mm_set1_epi32(static_cast<qint32>(HexChartScanner::BlueColor));
+	const auto red = _mm_set1_epi32(static_cast<qint32>(HexChartScanner::RedColor));
+	
+	for (; x + 4 <= width; x += 4)
+	{
+		const auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(line + x));
+		auto blueMask = static_cast<quint32>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(pixels, blue))));
+		auto redMask = static_cast<quint32>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(pixels, red))));
+		
+		while (blueMask != 0u)
+		{
+			const auto column = x + std::countr_zero(blueMask);
+			
+			if (tops[column] < 0)
+				tops[column] = y;
+			
+			blueMask &= blueMask - 1u;
+		}
+		
+		while (redMask != 0u)
+		{
+			bottoms[x + std::countr_zero(redMask)] = y;
+			redMask &= redMask - 1u;
+		}
+	}
+#endif
+
+	for (; x < width; ++x)
+	{
+		if (line[x] == HexChartScanner::BlueColor)
+		{
+			if (tops[x] < 0)
+				tops[x] = y;
+		}
+		else if (line[x] == HexChartScanner::RedColor)
+			bottoms[x] = y;
+	}
+}
+
+#endif
@@ -4,63 +4,265 @@
 // Qt Libraries
  #include <QDate>
  #include <QDir>
+ #include <QElapsedTimer>
  #include <QFile>
+ #include <QFileInfo>
 
 // Standard Libraries
 #include <algorithm>
+#include <atomic>
+#include <future>
 #include <iostream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <unordered_set>
 
 // Personal Libraries
-#include "HexDayHistory.hpp"
+#include "HexKernelTuner.hpp"
+#include "HexSearchBuffer.hpp"
+#include "HexSnapshotStore.hpp"
 
 class HexDataCenter
 {
 	private:
 	
-		inline static void				Count(const std::vector<HexFullFile>&, qint32&, qint32&, qint32&);
-		inline static void				WriteReport(const std::vector<HexFullFile>&, HexFullReport&, qreal, qreal, bool);
+		static constexpr quint32					CalibrationWindows = 20'000u;
+		static constexpr quint32					CalibrationRounds = 3u;
+		static constexpr quint32					IncrementalLimit = 2u;
+		static constexpr quint64					Megabyte = 1'048'576u;
+		static const quint64						MemoryCap;
 		
-		std::vector<HexDayHistory>			candlestickData;
-		std::vector<HexScanFile>			posiPrecedents;
-		std::vector<HexScanFile>			negaPrecedents;
-		std::vector<HexFullFile>			positivePrecedents;
-		std::vector<HexFullFile>			negativePrecedents;
+		template<class Kernel> inline static qreal			Calibrate(const HexDataSnapshot&, bool);
+		inline static void						Count(const std::vector<HexFullFile>&, qint32&, qint32&, qint32&);
+		inline static void						FullStudyFile(const HexDataSnapshot&, HexFullFile&, qreal, qreal);
+		inline static bool						ImportDirectory(HexDataSnapshot&, const HexDataSnapshot*, const QString&, quint32, const HexCancelToken&);
+		inline static std::shared_ptr<const HexDayHistory>		ImportFile(const QString&);
+		inline static bool						IsAmongNewest(const QString&, quint32, const QString&);
+		inline static bool						IsCurrent(const HexDataSnapshot&);
+		inline static QFileInfoList					ListDirectory(const QString&);
+		template<class Kernel> inline static const std::vector<HexPartialInfo>&	Partials(const HexSearchBuffer&, quint32);
+		inline static void						QuickStudyFile(const HexDayHistory&, HexScanFile&, qreal, bool);
+		inline static void						WriteReport(const std::vector<HexFullFile>&, HexFullReport&, qreal, qreal, bool);
 		
-		QString						currentDirectory;
-		qreal						bestScalar;
+		std::list<std::shared_ptr<const HexDataSnapshot>>		resident;
+		std::map<QString, std::shared_future<std::shared_ptr<const HexDataSnapshot>>>	building;
+		std::mutex							publishing;
+		std::mutex							calibrating;
+		std::atomic<quint64>						numberOfVersions = 0u;
+		HexKernelTuner							tuner;
+		HexSnapshotStore						store;
 		
-		inline void					clear(bool);
-		inline void					fullStudyFile(HexFullFile&, qreal, qreal) const;
-		inline void					quickStudyFile(HexScanFile&, qreal) const;
+		inline std::shared_ptr<const HexDataSnapshot>			build(const HexCancelToken&, const std::shared_ptr<const HexDataSnapshot>&, const QString&, quint32, quint32, quint32, qreal, bool);
+		inline void							calibrate(HexDataSnapshot&, bool);
+		inline void							evict(void);
+		template<class Kernel> inline void				locateBest(Kernel, HexSearchBuffer&, std::vector<HexCandlestick<qreal>>::const_iterator, quint32, quint32, quint32, quint32, qreal, bool, bool) const;
+		template<class Kernel> inline void				locateGraduates(Kernel, HexSearchBuffer&, std::vector<HexCandlestick<qreal>>::const_iterator, quint32, quint32, quint32, qreal, qreal, bool, bool) const;
+		inline quint64							memoryUsage(void) const;
+		inline std::shared_ptr<const HexDataSnapshot>			prepare(const HexCancelToken&, const QString&, quint32, quint32, quint32, qreal, bool);
+		template<class Kernel> inline void				updatePartials(HexSearchBuffer&, std::vector<HexCandlestick<qreal>>::const_iterator, quint32, quint32) const;
 	
 	public:
 	
-		inline std::vector<HexCandlestick<qreal>>	getCandlesticks(qint32, bool) const;
-		inline const std::vector<HexFullFile>&		getNegativePrecedents(void) const;
-		inline const std::vector<HexFullFile>&		getPositivePrecedents(void) const;
-		inline HexFullReport				fullReport(qreal, qreal) const;
-		inline void					fullStudy(qreal, qreal);
-		inline void					importFile(const QString&);
-		inline bool					importDirectory(const QString&, quint32);
-		inline void					locateBest(std::vector<HexCandlestick<qreal>>::const_iterator, quint32, quint32, quint32, quint32, qreal, bool, bool);
-		inline void					locateGraduates(std::vector<HexCandlestick<qreal>>::const_iterator, quint32, quint32, quint32, qreal, qreal, bool, bool);
-		inline void					quickStudy(qreal);
-		inline HexScanReport				scanReport(qreal) const;
-		inline void					setUpHistory(quint32, quint32, quint32);
+		inline bool							acquire(HexSearchBuffer&, const QString&, quint32, quint32, quint32, quint32);
+		inline bool							acquire(HexSearchBuffer&, const QString&, quint32, quint32, quint32, quint32, const QString&);
+		inline HexFullReport						fullReport(const HexSearchBuffer&, qreal, qreal) const;
+		inline void							fullStudy(HexSearchBuffer&, qreal, qreal) const;
+		inline void							locateBest(HexSearchBuffer&, std::vector<HexCandlestick<qreal>>::const_iterator, quint32, quint32, quint32, quint32, qreal, bool, bool) const;
+		inline void							locateGraduates(HexSearchBuffer&, std::vector<HexCandlestick<qreal>>::const_iterator, quint32, quint32, quint32, qreal, qreal, bool, bool) const;
+		inline bool							preload(const HexCancelToken&, const QString&, quint32, quint32, quint32, qreal);
+		inline void							quickStudy(HexSearchBuffer&, qreal) const;
+		inline HexScanReport						scanReport(const HexSearchBuffer&, qreal) const;
 };
 
-void HexDataCenter::clear(bool scan)
+bool HexDataCenter::acquire(HexSearchBuffer& buffer, const QString& directory, quint32 numberOfDays, quint32 timeUnit, quint32 numberOfCandlesticks, quint32 scope)
 {
-	if (scan)
+	const auto firstCoefficient = HexNormalisedInfo::FirstCoefficient();
+	const auto& snapshot = buffer.snapshot;
+	
+	if (snapshot != nullptr and snapshot->calibrated and snapshot->matches(directory, numberOfDays, timeUnit, numberOfCandlesticks, firstCoefficient) and HexDataCenter::IsCurrent(*snapshot))
 	{
-		HexDataCenter::posiPrecedents.clear();
-		HexDataCenter::negaPrecedents.clear();
+		buffer.attach(buffer.snapshot, scope);
+		return true;
 	}
-	else
+	
+	auto next = HexDataCenter::prepare(buffer.token, directory, numberOfDays, timeUnit, numberOfCandlesticks, firstCoefficient, true);
+	
+	if (next == nullptr)
+		return false;
+	
+	buffer.attach(std::move(next), scope);
+	return true;
+}
+
+bool HexDataCenter::acquire(HexSearchBuffer& buffer, const QString& directory, quint32 numberOfDays, quint32 timeUnit, quint32 numberOfCandlesticks, quint32 scope, const QString& excluded)
+{
+	const auto& snapshot = buffer.snapshot;
+	
+	if (snapshot != nullptr and snapshot->calibrated and snapshot->matches(directory, numberOfDays, timeUnit, numberOfCandlesticks, HexNormalisedInfo::FirstCoefficient(), excluded) and HexDataCenter::IsCurrent(*snapshot))
+	{
+		buffer.attach(buffer.snapshot, scope);
+		return true;
+	}
+	
+	if (not HexDataCenter::IsAmongNewest(directory, numberOfDays, excluded))
+		return HexDataCenter::acquire(buffer, directory, numberOfDays, timeUnit, numberOfCandlesticks, scope);
+	
+	if (not HexDataCenter::acquire(buffer, directory, numberOfDays + 1u, timeUnit, numberOfCandlesticks, scope))
+		return false;
+	
+	std::cout << " >> Day [" << excluded.toStdString() << "] excluded from [" << directory.toStdString() << "]." << std::endl;
+	buffer.attach(buffer.snapshot->excluding(excluded, numberOfDays), scope);
+	return true;
+}
+
+std::shared_ptr<const HexDataSnapshot> HexDataCenter::build(const HexCancelToken& token, const std::shared_ptr<const HexDataSnapshot>& stale, const QString& directory, quint32 numberOfDays, quint32 timeUnit, quint32 numberOfCandlesticks, qreal firstCoefficient, bool benchmarking)
+{
+	std::shared_ptr<const HexDataSnapshot> base;
+	std::shared_ptr<const HexDataSnapshot> stored;
+	auto sameConfiguration = false;
+	
+	{
+		std::lock_guard<std::mutex> lock(HexDataCenter::publishing);
+		
+		auto found = std::find_if(HexDataCenter::resident.cbegin(), HexDataCenter::resident.cend(), [&](const auto& snapshot)
+		{
+			return (snapshot->directory == directory and snapshot->timeUnit == timeUnit and snapshot->numberOfCandlesticks == numberOfCandlesticks and snapshot->firstCoefficient == firstCoefficient);
+		});
+		
+		sameConfiguration = (found != HexDataCenter::resident.cend());
+		
+		if (not sameConfiguration)
+			found = std::find_if(HexDataCenter::resident.cbegin(), HexDataCenter::resident.cend(), [&](const auto& snapshot){ return (snapshot->directory == directory); });
+		
+		if (found != HexDataCenter::resident.cend())
+			base = *found;
+	}
+	
+	if (not sameConfiguration)
+		stored = HexDataCenter::store.load(directory, numberOfDays, timeUnit, numberOfCandlesticks, firstCoefficient);
+	
+	auto next = std::make_shared<HexDataSnapshot>();
+	
+	if (not HexDataCenter::ImportDirectory(*next, (stale != nullptr ? stale.get() : (stored != nullptr ? stored.get() : base.get())), directory, numberOfDays, token))
+		return nullptr;
+	
+	next->timeUnit = timeUnit;
+	next->numberOfCandlesticks = numberOfCandlesticks;
+	next->firstCoefficient = firstCoefficient;
+	next->weighted = (firstCoefficient != 1.);
+	next->version = ++HexDataCenter::numberOfVersions;
+	
+	const auto coefficients = HexNormalisedInfo::MakeCoefficients(firstCoefficient, numberOfCandlesticks);
+	auto fresh = (stored != nullptr and (stored->files != next->files or stored->stamps != next->stamps));
+	
+	HexKernelSwitch::Dispatch(numberOfCandlesticks, [&](auto kernel)
+	{
+		for (auto& day : next->days)
+		{
+			if (token.isCancelled())
+				return;
+			
+			if (not day->isNormalised(timeUnit, numberOfCandlesticks, firstCoefficient))
+			{
+				day = day->normalised<decltype(kernel)>(timeUnit, numberOfCandlesticks, coefficients);
+				fresh = true;
+			}
+		}
+	});
+	
+	if (token.isCancelled())
+		return nullptr;
+	
+	HexDataCenter::calibrate(*next, benchmarking);
+	std::cout << " >> Snapshot " << next->version << (benchmarking ? " published" : " preloaded") << " over " << next->days.size() << " days." << std::endl;
+	
+	if (fresh)
+		HexDataCenter::store.save(next);
+	
+	return next;
+}
+
+template<class Kernel>
+qreal HexDataCenter::Calibrate(const HexDataSnapshot& snapshot, bool nemesis)
+{
+	auto bestTime = std::numeric_limits<qint64>::max();
+	auto numberOfWindows = 0u;
+	auto checksum = 0.;
+	
+	for (auto round = 0u; round < HexDataCenter::CalibrationRounds; ++round)
 	{
-		HexDataCenter::positivePrecedents.clear();
-		HexDataCenter::negativePrecedents.clear();
+		QElapsedTimer timer;
+		timer.start();
+		numberOfWindows = 0u;
+		
+		for (const auto& foo : snapshot.days)
+		{
+			numberOfWindows += foo->benchmark<Kernel>(nemesis, HexDataCenter::CalibrationWindows - numberOfWindows, checksum);
+			
+			if (numberOfWindows >= HexDataCenter::CalibrationWindows)
+				break;
+		}
+		
+		bestTime = std::min(timer.nsecsElapsed(), bestTime);
 	}
+	
+	if (numberOfWindows == 0u or std::isnan(checksum))
+		return 0.;
+	
+	return static_cast<qreal>(numberOfWindows)*1'000./static_cast<qreal>(std::max(bestTime, static_cast<qint64>(1)));
+}
+
+void HexDataCenter::calibrate(HexDataSnapshot& snapshot, bool benchmarking)
+{
+	std::lock_guard<std::mutex> lock(HexDataCenter::calibrating);
+	const auto numberOfCandlesticks = snapshot.numberOfCandlesticks;
+	
+	for (const auto nemesis : { false, true })
+	{
+		if (HexDataCenter::tuner.contains(numberOfCandlesticks, snapshot.weighted, nemesis) or not benchmarking)
+			continue;
+		
+		HexKernelChoice best;
+		best.throughput = -1.;
+		
+		for (const auto strategy : { KernelEnum::Generic, KernelEnum::Specialised, KernelEnum::Paired })
+		{
+			if (strategy == KernelEnum::Specialised and not HexKernelSwitch::IsSpecialised(numberOfCandlesticks))
+				continue;
+			
+			if (strategy == KernelEnum::Paired and not nemesis)
+				continue;
+			
+			const auto throughput = HexKernelSwitch::Dispatch(numberOfCandlesticks, strategy, [&](auto kernel)
+			{
+				return HexDataCenter::Calibrate<decltype(kernel)>(snapshot, nemesis);
+			});
+			
+			std::cout << " >> Kernel [" << HexKernelSwitch::Name(strategy).toStdString() << "] runs at " << throughput << " windows/us." << std::endl;
+			
+			if (throughput > best.throughput)
+			{
+				best.strategy = strategy;
+				best.throughput = throughput;
+			}
+		}
+		
+		if (best.throughput > 0.)
+			HexDataCenter::tuner.record(numberOfCandlesticks, snapshot.weighted, nemesis, best);
+	}
+	
+	HexDataCenter::tuner.save();
+	
+	snapshot.straightChoice = HexDataCenter::tuner.choice(numberOfCandlesticks, snapshot.weighted, false);
+	snapshot.nemesisChoice = HexDataCenter::tuner.choice(numberOfCandlesticks, snapshot.weighted, true);
+	snapshot.calibrated = (benchmarking or (HexDataCenter::tuner.contains(numberOfCandlesticks, snapshot.weighted, false) and HexDataCenter::tuner.contains(numberOfCandlesticks, snapshot.weighted, true)));
+	
+	if (not snapshot.calibrated)
+		return;
+	
+	std::cout << "Kernel [" << HexKernelSwitch::Name(snapshot.straightChoice.strategy).toStdString() << "] selected at " << snapshot.straightChoice.throughput << " windows/us";
+	std::cout << ", [" << HexKernelSwitch::Name(snapshot.nemesisChoice.strategy).toStdString() << "] with nemesis at " << snapshot.nemesisChoice.throughput << " windows/us." << std::endl;
 }
 
 void HexDataCenter::Count(const std::vector<HexFullFile>& precedents, qint32& bWin, qint32& eWin, qint32& sWin)
@@ -87,59 +289,69 @@ void HexDataCenter::Count(const std::vector<HexFullFile>& precedents, qint32& bW
 	}
 }
 
-HexFullReport HexDataCenter::fullReport(qreal takeProfit, qreal stopLoss) const
+void HexDataCenter::evict(void)
 {
-	HexFullReport report;
-	
-	HexDataCenter::WriteReport(positivePrecedents, report, takeProfit, stopLoss, true);
-	HexDataCenter::WriteReport(negativePrecedents, report, takeProfit, stopLoss, false);
+	auto usage = HexDataCenter::memoryUsage();
 	
-	if (not HexDataCenter::positivePrecedents.empty())
-		report.worstSimilarity = HexDataCenter::positivePrecedents.back().similarity;
+	while (usage > HexDataCenter::MemoryCap and HexDataCenter::resident.size() > 1u)
+	{
+		std::cout << " >> Snapshot " << HexDataCenter::resident.back()->version << " evicted." << std::endl;
+		HexDataCenter::resident.pop_back();
+		usage = HexDataCenter::memoryUsage();
+	}
 	
-	if ((not HexDataCenter::negativePrecedents.empty()) and HexDataCenter::negativePrecedents.back().similarity < report.worstSimilarity)
-		report.worstSimilarity = HexDataCenter::negativePrecedents.back().similarity;
+	for (const auto& snapshot : HexDataCenter::resident)
+	{
+		std::cout << " >> Snapshot " << snapshot->version << " [" << snapshot->directory.toStdString() << "] " << snapshot->timeUnit << "x" << snapshot->numberOfCandlesticks;
+		std::cout << " at " << snapshot->firstCoefficient*100. << "% over " << snapshot->days.size() << " days: " << snapshot->memoryUsage()/HexDataCenter::Megabyte << " MB." << std::endl;
+	}
 	
-	return report;
+	std::cout << " >> Resident data: " << usage/HexDataCenter::Megabyte << " MB out of " << HexDataCenter::MemoryCap/HexDataCenter::Megabyte << " MB." << std::endl;
 }
 
-void HexDataCenter::fullStudy(qreal tp, qreal sl)
+HexFullReport HexDataCenter::fullReport(const HexSearchBuffer& buffer, qreal takeProfit, qreal stopLoss) const
 {
-	for (auto& file : HexDataCenter::positivePrecedents)
-		HexDataCenter::fullStudyFile(file, file.factor*tp, file.factor*sl);
+	HexFullReport report;
 	
-	for (auto& file : HexDataCenter::negativePrecedents)
-		HexDataCenter::fullStudyFile(file, file.factor*tp, file.factor*sl);
-}
-
-void HexDataCenter::fullStudyFile(HexFullFile& file, qreal equivalentTP, qreal equivalentSL) const
-{
-	file.bestBuyProfit = HexDataCenter::candlestickData[file.day].bestBuyAndSell(file.tradeTimeSpot, file.lastHigh, equivalentSL);
-	file.bestSellProfit = HexDataCenter::candlestickData[file.day].bestSellAndBuy(file.tradeTimeSpot, file.lastLow, equivalentSL);
-	file.foo = (file.bestBuyProfit >= equivalentTP ? (file.bestSellProfit >= equivalentTP ? 'e' : 'b' ) : (file.bestSellProfit >= equivalentTP ? 's' : 'u' ));
-}
-
-std::vector<HexCandlestick<qreal>> HexDataCenter::getCandlesticks(qint32 count, bool positive) const
-{
-	const auto& sf = (positive ? HexDataCenter::positivePrecedents[static_cast<quint32>(count)] : HexDataCenter::negativePrecedents[static_cast<quint32>(count)]);
-	const auto numberOfCandlesticks = (sf.tradeTimeSpot - sf.sampleTimeSpot)/sf.timeUnit;
+	HexDataCenter::WriteReport(buffer.positivePrecedents, report, takeProfit, stopLoss, true);
+	HexDataCenter::WriteReport(buffer.negativePrecedents, report, takeProfit, stopLoss, false);
+	
+	if (not buffer.positivePrecedents.empty())
+		report.worstSimilarity = buffer.positivePrecedents.back().similarity;
 	
-	const auto sizeOfHistory = HexDataCenter::candlestickData[sf.day].sizeOfHistory();
-	const auto numberOfCandlesticksToDraw = (sf.sampleTimeSpot + (numberOfCandlesticks*6u/5u)*sf.timeUnit < sizeOfHistory ? numberOfCandlesticks*6u/5u : numberOfCandlesticks);
-	return HexDataCenter::candlestickData[sf.day].getCandlesticks(sf.sampleTimeSpot, sf.timeUnit, numberOfCandlesticksToDraw);
+	if ((not buffer.negativePrecedents.empty()) and buffer.negativePrecedents.back().similarity < report.worstSimilarity)
+		report.worstSimilarity = buffer.negativePrecedents.back().similarity;
+	
+	return report;
 }
 
-const std::vector<HexFullFile>& HexDataCenter::getNegativePrecedents(void) const
+void HexDataCenter::fullStudy(HexSearchBuffer& buffer, qreal tp, qreal sl) const
 {
-	return HexDataCenter::negativePrecedents;
+	for (auto& file : buffer.positivePrecedents)
+	{
+		if (buffer.token.isCancelled())
+			return;
+		
+		HexDataCenter::FullStudyFile(*buffer.snapshot, file, file.factor*tp, file.factor*sl);
+	}
+	
+	for (auto& file : buffer.negativePrecedents)
+	{
+		if (buffer.token.isCancelled())
+			return;
+		
+		HexDataCenter::FullStudyFile(*buffer.snapshot, file, file.factor*tp, file.factor*sl);
+	}
 }
 
-const std::vector<HexFullFile>& HexDataCenter::getPositivePrecedents(void) const
+void HexDataCenter::FullStudyFile(const HexDataSnapshot& snapshot, HexFullFile& file, qreal equivalentTP, qreal equivalentSL)
 {
-	return HexDataCenter::positivePrecedents;
+	file.bestBuyProfit = snapshot.days[file.day]->bestBuyAndSell(file.tradeTimeSpot, file.lastHigh, equivalentSL, false);
+	file.bestSellProfit = snapshot.days[file.day]->bestSellAndBuy(file.tradeTimeSpot, file.lastLow, equivalentSL, false);
+	file.foo = (file.bestBuyProfit >= equivalentTP ? (file.bestSellProfit >= equivalentTP ? 'e' : 'b' ) : (file.bestSellProfit >= equivalentTP ? 's' : 'u' ));
 }
 
-bool HexDataCenter::importDirectory(const QString& directory, quint32 nb)
+bool HexDataCenter::ImportDirectory(HexDataSnapshot& snapshot, const HexDataSnapshot* base, const QString& directory, quint32 nb, const HexCancelToken& token)
 {
 	const auto path = "input/" + directory + '/';
 	QDir dataDir(path);
@@ -154,7 +366,7 @@ bool HexDataCenter::importDirectory(const QString& directory, quint32 nb)
 		return false;
 	}
 	
-	const auto files = dataDir.entryList();
+	const auto files = dataDir.entryInfoList();
 	const auto numberOfFiles = files.size();
 	
 	if (nb > numberOfFiles)
@@ -163,43 +375,54 @@ bool HexDataCenter::importDirectory(const QString& directory, quint32 nb)
 		return false;
 	}
 	
-	if (HexDataCenter::currentDirectory != directory)
-	{
-		HexDataCenter::candlestickData.clear();
-		HexDataCenter::currentDirectory = directory;
-	}
-	
-	while (HexDataCenter::candlestickData.size() > nb)
-		HexDataCenter::candlestickData.pop_back();
+	if (base != nullptr and base->directory != directory)
+		base = nullptr;
 	
-	if (HexDataCenter::candlestickData.size() == nb)
-		return true;
+	snapshot.directory = directory;
+	auto numberOfImports = 0u;
 	
-	for (auto it = files.crbegin() + HexDataCenter::candlestickData.size(); it != files.crend(); ++it)
+	for (auto it = files.crbegin(); it != files.crend() and snapshot.days.size() < nb; ++it)
 	{
-		const auto filePath = path + (*it);
-		HexDataCenter::importFile(filePath);
+		if (token.isCancelled())
+			return false;
+		
+		const auto name = it->fileName();
+		const HexFileStamp stamp(it->size(), it->lastModified().toMSecsSinceEpoch());
+		const auto index = (base != nullptr ? base->files.indexOf(name) : -1);
+		const auto reused = (index >= 0 and base->stamps[index] == stamp);
+		auto day = (reused ? base->days[index] : HexDataCenter::ImportFile(path + name));
+		
+		if (day == nullptr)
+			continue;
 		
-		if (HexDataCenter::candlestickData.size() == nb)
-			break;
+		if (not reused)
+			++numberOfImports;
+		
+		snapshot.days.push_back(std::move(day));
+		snapshot.files.push_back(name);
+		snapshot.stamps.push_back(stamp);
 	}
 	
-	return (HexDataCenter::candlestickData.size() == nb);
+	if (base != nullptr and numberOfImports != 0u)
+		std::cout << " >> " << numberOfImports << " new days imported into [" << directory.toStdString() << "]." << std::endl;
+	
+	return (snapshot.days.size() == nb);
 }
 
-void HexDataCenter::importFile(const QString& filePath)
+std::shared_ptr<const HexDayHistory> HexDataCenter::ImportFile(const QString& filePath)
 {
 	QFile dataFile(filePath);
 	
 	if (!dataFile.open(QIODevice::ReadOnly | QIODevice::Text))
 	{
 		std::cout << "Could not read file [" << filePath.toStdString() + "]." << std::endl;
-		return;
+		return nullptr;
 	}
 	
 	QTextStream fileReader(&dataFile);
 	const auto date = QDate::fromString(filePath.split('_')[1u], "yyyyMMdd").toString("ddd dd MMM");
-	auto& record = HexDataCenter::candlestickData.emplace_back(date);
+	auto record = std::make_shared<std::vector<HexCandlestick<qreal>>>();
+	record->reserve(23'400u);
 	
 	fileReader.readLine();
 	fileReader.readLine();
@@ -209,16 +432,87 @@ void HexDataCenter::importFile(const QString& filePath)
 		const auto numbers = fileReader.readLine().split(' ');
 		
 		if (numbers.size() == 2u)
-			record.addEntry(numbers[0u].toDouble(), numbers[1u].toDouble());
+			record->emplace_back(numbers[0u].toDouble(), numbers[1u].toDouble());
 		else
 			std::cout << "File [" << filePath.toStdString() + "] has unappropriate entry." << std::endl;
 	}
+	
+	return std::make_shared<HexDayHistory>(date, std::move(record));
+}
+
+bool HexDataCenter::IsAmongNewest(const QString& directory, quint32 nb, const QString& file)
+{
+	const auto files = HexDataCenter::ListDirectory(directory);
+	auto index = 0u;
+	
+	for (auto it = files.crbegin(); it != files.crend() and index < nb; ++it, ++index)
+	{
+		if (it->fileName() == file)
+			return true;
+	}
+	
+	return false;
+}
+
+// A snapshot is current while the newest files of its directory are still the ones it was built from,
+// with the same size and modification time; a rewrite in place does not touch the directory itself.
+// The day a snapshot was built without is skipped, it is in the listing but never in the snapshot.
+bool HexDataCenter::IsCurrent(const HexDataSnapshot& snapshot)
+{
+	const auto files = HexDataCenter::ListDirectory(snapshot.directory);
+	auto index = 0u;
+	
+	for (auto it = files.crbegin(); it != files.crend() and index < snapshot.files.size(); ++it)
+	{
+		if (it->fileName() == snapshot.excluded)
+			continue;
+		
+		if (it->fileName() != snapshot.files[index] or HexFileStamp(it->size(), it->lastModified().toMSecsSinceEpoch()) != snapshot.stamps[index])
+			return false;
+		
+		++index;
+	}
+	
+	return (index == snapshot.files.size());
+}
+
+QFileInfoList HexDataCenter::ListDirectory(const QString& directory)
+{
+	QDir dataDir("input/" + directory + '/');
+	
+	dataDir.setNameFilters({ "*.txt" });
+	dataDir.setFilter(QDir::Files | QDir::Hidden | QDir::NoSymLinks);
+	dataDir.setSorting(QDir::Name);
+	
+	return dataDir.entryInfoList();
+}
+
+void HexDataCenter::locateBest(HexSearchBuffer& buffer, std::vector<HexCandlestick<qreal>>::const_iterator it, quint32 timeUnit, quint32 feedingTimeUnit, quint32 numberOfCandlesticks, quint32 numberOfCandidates, qreal now, bool nemesis, bool feedOrScan) const
+{
+	if (buffer.snapshot == nullptr)
+		return;
+	
+	const auto& choice = buffer.snapshot->choice(nemesis);
+	
+	HexKernelSwitch::Dispatch(numberOfCandlesticks, choice.strategy, [&](auto kernel)
+	{
+		using Kernel = decltype(kernel);
+		
+		if (feedOrScan and buffer.incremental)
+		{
+			HexDataCenter::updatePartials<Kernel>(buffer, it, timeUnit/feedingTimeUnit, numberOfCandlesticks);
+			HexDataCenter::locateBest(HexKernel<Kernel::Length, Kernel::Paired, true>(), buffer, it, timeUnit, feedingTimeUnit, numberOfCandlesticks, numberOfCandidates, now, nemesis, feedOrScan);
+		}
+		else
+			HexDataCenter::locateBest(kernel, buffer, it, timeUnit, feedingTimeUnit, numberOfCandlesticks, numberOfCandidates, now, nemesis, feedOrScan);
+	});
 }
 
-void HexDataCenter::locateBest(std::vector<HexCandlestick<qreal>>::const_iterator it, quint32 timeUnit, quint32 feedingTimeUnit, quint32 numberOfCandlesticks, quint32 numberOfCandidates, qreal now, bool nemesis, bool feedOrScan)
+template<class Kernel>
+void HexDataCenter::locateBest(Kernel kernel, HexSearchBuffer& buffer, std::vector<HexCandlestick<qreal>>::const_iterator it, quint32 timeUnit, quint32 feedingTimeUnit, quint32 numberOfCandlesticks, quint32 numberOfCandidates, qreal now, bool nemesis, bool feedOrScan) const
 {
-	HexNormalisedInfo straightPattern(it, timeUnit/feedingTimeUnit, numberOfCandlesticks);
-	HexNormalisedInfo reversedPattern(straightPattern);
+	HexNormalisedInfo straightPattern(kernel, it, timeUnit/feedingTimeUnit, numberOfCandlesticks);
+	const auto reversedPattern = HexNormalisedInfo::Reversed(straightPattern);
 	
 	if (straightPattern.norm == 0.)
 	{
@@ -226,50 +520,82 @@ void HexDataCenter::locateBest(std::vector<HexCandlestick<qreal>>::const_iterato
 		return;
 	}
 	
-	feedOrScan ? HexDataCenter::posiPrecedents.clear() : positivePrecedents.clear();
-	feedOrScan ? HexDataCenter::negaPrecedents.clear() : negativePrecedents.clear();
+	feedOrScan ? buffer.posiPrecedents.clear() : buffer.positivePrecedents.clear();
+	feedOrScan ? buffer.negaPrecedents.clear() : buffer.negativePrecedents.clear();
 	
+	const auto& days = buffer.snapshot->days;
 	const auto numberOfElementaryCandlesticks = timeUnit*numberOfCandlesticks;
-	auto day = 0u;
 	
-	HexCandidatePool fullPool(HexDataCenter::positivePrecedents, HexDataCenter::negativePrecedents, numberOfElementaryCandlesticks, numberOfCandidates);
-	HexCandidatePool scanPool(HexDataCenter::posiPrecedents, HexDataCenter::negaPrecedents, numberOfElementaryCandlesticks, numberOfCandidates);
+	HexCandidatePool fullPool(buffer.positivePrecedents, buffer.negativePrecedents, numberOfElementaryCandlesticks, numberOfCandidates);
+	HexCandidatePool scanPool(buffer.posiPrecedents, buffer.negaPrecedents, numberOfElementaryCandlesticks, numberOfCandidates);
 	
 	if (nemesis)
 	{
 		if (feedOrScan)
 		{
-			for (const auto& foo : candlestickData)
-				foo.locateBestWithNemesis(straightPattern, reversedPattern, scanPool, day++, numberOfCandidates, now);
+			for (auto day = 0u; day < days.size() and not buffer.token.isCancelled(); ++day)
+				days[day]->locateBestWithNemesis<Kernel>(straightPattern, reversedPattern, scanPool, HexDataCenter::Partials<Kernel>(buffer, day), day, numberOfCandidates, buffer.scope, days[day]->timeSpot(now));
 		}
 		else
 		{
-			for (const auto& foo : candlestickData)
-				foo.locateBestWithNemesis(straightPattern, reversedPattern, fullPool, day++, numberOfCandidates, now);
+			for (auto day = 0u; day < days.size() and not buffer.token.isCancelled(); ++day)
+				days[day]->locateBestWithNemesis<Kernel>(straightPattern, reversedPattern, fullPool, HexDataCenter::Partials<Kernel>(buffer, day), day, numberOfCandidates, buffer.scope, days[day]->timeSpot(now));
 		}
 	}
 	else
 	{
 		if (feedOrScan)
 		{
-			for (const auto& foo : candlestickData)
-				foo.locateBestWithoutNemesis(straightPattern, scanPool, day++, numberOfCandidates, now);
+			for (auto day = 0u; day < days.size() and not buffer.token.isCancelled(); ++day)
+				days[day]->locateBestWithoutNemesis<Kernel>(straightPattern, scanPool, HexDataCenter::Partials<Kernel>(buffer, day), day, numberOfCandidates, buffer.scope, days[day]->timeSpot(now));
 		}
 		else
 		{
-			for (const auto& foo : candlestickData)
-				foo.locateBestWithoutNemesis(straightPattern, fullPool, day++, numberOfCandidates, now);
+			for (auto day = 0u; day < days.size() and not buffer.token.isCancelled(); ++day)
+				days[day]->locateBestWithoutNemesis<Kernel>(straightPattern, fullPool, HexDataCenter::Partials<Kernel>(buffer, day), day, numberOfCandidates, buffer.scope, days[day]->timeSpot(now));
 		}
 	}
 	
-	feedOrScan ? std::sort(HexDataCenter::posiPrecedents.begin(), HexDataCenter::posiPrecedents.end()) : std::sort(HexDataCenter::positivePrecedents.begin(), HexDataCenter::positivePrecedents.end());
-	feedOrScan ? std::sort(HexDataCenter::negaPrecedents.begin(), HexDataCenter::negaPrecedents.end()) : std::sort(HexDataCenter::negativePrecedents.begin(), HexDataCenter::negativePrecedents.end());
+	if (feedOrScan and buffer.today != nullptr and not buffer.token.isCancelled())
+	{
+		const auto today = static_cast<quint32>(days.size());
+		
+		if (nemesis)
+			buffer.today->locateBestWithNemesis<Kernel>(straightPattern, reversedPattern, scanPool, HexDataCenter::Partials<Kernel>(buffer, today), today, numberOfCandidates, buffer.scope, buffer.today->timeSpot(now));
+		else
+			buffer.today->locateBestWithoutNemesis<Kernel>(straightPattern, scanPool, HexDataCenter::Partials<Kernel>(buffer, today), today, numberOfCandidates, buffer.scope, buffer.today->timeSpot(now));
+	}
+	
+	feedOrScan ? std::sort(buffer.posiPrecedents.begin(), buffer.posiPrecedents.end()) : std::sort(buffer.positivePrecedents.begin(), buffer.positivePrecedents.end());
+	feedOrScan ? std::sort(buffer.negaPrecedents.begin(), buffer.negaPrecedents.end()) : std::sort(buffer.negativePrecedents.begin(), buffer.negativePrecedents.end());
+}
+
+void HexDataCenter::locateGraduates(HexSearchBuffer& buffer, std::vector<HexCandlestick<qreal>>::const_iterator it, quint32 timeUnit, quint32 feedingTimeUnit, quint32 numberOfCandlesticks, qreal threshold, qreal now, bool nemesis, bool feedOrScan) const
+{
+	if (buffer.snapshot == nullptr)
+		return;
+	
+	const auto& choice = buffer.snapshot->choice(nemesis);
+	
+	HexKernelSwitch::Dispatch(numberOfCandlesticks, choice.strategy, [&](auto kernel)
+	{
+		using Kernel = decltype(kernel);
+		
+		if (feedOrScan and buffer.incremental)
+		{
+			HexDataCenter::updatePartials<Kernel>(buffer, it, timeUnit/feedingTimeUnit, numberOfCandlesticks);
+			HexDataCenter::locateGraduates(HexKernel<Kernel::Length, Kernel::Paired, true>(), buffer, it, timeUnit, feedingTimeUnit, numberOfCandlesticks, threshold, now, nemesis, feedOrScan);
+		}
+		else
+			HexDataCenter::locateGraduates(kernel, buffer, it, timeUnit, feedingTimeUnit, numberOfCandlesticks, threshold, now, nemesis, feedOrScan);
+	});
 }
 
-void HexDataCenter::locateGraduates(std::vector<HexCandlestick<qreal>>::const_iterator it, quint32 timeUnit, quint32 feedingTimeUnit, quint32 numberOfCandlesticks, qreal threshold, qreal now, bool nemesis, bool feedOrScan)
+template<class Kernel>
+void HexDataCenter::locateGraduates(Kernel kernel, HexSearchBuffer& buffer, std::vector<HexCandlestick<qreal>>::const_iterator it, quint32 timeUnit, quint32 feedingTimeUnit, quint32 numberOfCandlesticks, qreal threshold, qreal now, bool nemesis, bool feedOrScan) const
 {
-	HexNormalisedInfo straightPattern(it, timeUnit/feedingTimeUnit, numberOfCandlesticks);
-	HexNormalisedInfo reversedPattern(straightPattern);
+	HexNormalisedInfo straightPattern(kernel, it, timeUnit/feedingTimeUnit, numberOfCandlesticks);
+	const auto reversedPattern = HexNormalisedInfo::Reversed(straightPattern);
 	
 	if (straightPattern.norm == 0.)
 	{
@@ -277,33 +603,33 @@ void HexDataCenter::locateGraduates(std::vector<HexCandlestick<qreal>>::const_it
 		return;
 	}
 	
-	feedOrScan ? HexDataCenter::posiPrecedents.clear() : positivePrecedents.clear();
-	feedOrScan ? HexDataCenter::negaPrecedents.clear() : negativePrecedents.clear();
+	feedOrScan ? buffer.posiPrecedents.clear() : buffer.positivePrecedents.clear();
+	feedOrScan ? buffer.negaPrecedents.clear() : buffer.negativePrecedents.clear();
 	
+	const auto& days = buffer.snapshot->days;
 	const auto numberOfElementaryCandlesticks = timeUnit*numberOfCandlesticks;
-	auto day = 0u;
 	
-	HexGraduatePool fullPool(HexDataCenter::positivePrecedents, HexDataCenter::negativePrecedents, numberOfElementaryCandlesticks);
-	HexGraduatePool scanPool(HexDataCenter::posiPrecedents, HexDataCenter::negaPrecedents, numberOfElementaryCandlesticks);
+	HexGraduatePool fullPool(buffer.positivePrecedents, buffer.negativePrecedents, numberOfElementaryCandlesticks);
+	HexGraduatePool scanPool(buffer.posiPrecedents, buffer.negaPrecedents, numberOfElementaryCandlesticks);
 	
-	HexDataCenter::bestScalar = 0.;
+	buffer.bestScalar = 0.;
 	
 	if (nemesis)
 	{
 		if (feedOrScan)
 		{
-			for (const auto& foo : candlestickData)
+			for (auto day = 0u; day < days.size() and not buffer.token.isCancelled(); ++day)
 			{
-				const auto best = foo.locateGraduatesWithNemesis(straightPattern, reversedPattern, scanPool, day++, threshold, now);
-				HexDataCenter::bestScalar = std::max(best, HexDataCenter::bestScalar);
+				const auto best = days[day]->locateGraduatesWithNemesis<Kernel>(straightPattern, reversedPattern, scanPool, HexDataCenter::Partials<Kernel>(buffer, day), day, buffer.scope, threshold, days[day]->timeSpot(now));
+				buffer.bestScalar = std::max(best, buffer.bestScalar);
 			}
 		}
 		else
 		{
-			for (const auto& foo : candlestickData)
+			for (auto day = 0u; day < days.size() and not buffer.token.isCancelled(); ++day)
 			{
-				const auto best = foo.locateGraduatesWithNemesis(straightPattern, reversedPattern, fullPool, day++, threshold, now);
-				HexDataCenter::bestScalar = std::max(best, HexDataCenter::bestScalar);
+				const auto best = days[day]->locateGraduatesWithNemesis<Kernel>(straightPattern, reversedPattern, fullPool, HexDataCenter::Partials<Kernel>(buffer, day), day, buffer.scope, threshold, days[day]->timeSpot(now));
+				buffer.bestScalar = std::max(best, buffer.bestScalar);
 			}
 		}
 	}
@@ -311,46 +637,188 @@ void HexDataCenter::locateGraduates(std::vector<HexCandlestick<qreal>>::const_it
 	{
 		if (feedOrScan)
 		{
-			for (const auto& foo : candlestickData)
+			for (auto day = 0u; day < days.size() and not buffer.token.isCancelled(); ++day)
 			{
-				const auto best = foo.locateGraduatesWithoutNemesis(straightPattern, scanPool, day++, threshold, now);
-				HexDataCenter::bestScalar = std::max(best, HexDataCenter::bestScalar);
+				const auto best = days[day]->locateGraduatesWithoutNemesis<Kernel>(straightPattern, scanPool, HexDataCenter::Partials<Kernel>(buffer, day), day, buffer.scope, threshold, days[day]->timeSpot(now));
+				buffer.bestScalar = std::max(best, buffer.bestScalar);
 			}
 		}
 		else
 		{
-			for (const auto& foo : candlestickData)
+			for (auto day = 0u; day < days.size() and not buffer.token.isCancelled(); ++day)
 			{
-				const auto best = foo.locateGraduatesWithoutNemesis(straightPattern, fullPool, day++, threshold, now);
-				HexDataCenter::bestScalar = std::max(best, HexDataCenter::bestScalar);
+				const auto best = days[day]->locateGraduatesWithoutNemesis<Kernel>(straightPattern, fullPool, HexDataCenter::Partials<Kernel>(buffer, day), day, buffer.scope, threshold, days[day]->timeSpot(now));
+				buffer.bestScalar = std::max(best, buffer.bestScalar);
 			}
 		}
 	}
+	if (feedOrScan and buffer.today != nullptr and not buffer.token.isCancelled())
+	{
+		const auto today = static_cast<quint32>(days.size());
+		const auto best = (nemesis ? buffer.today->locateGraduatesWithNemesis<Kernel>(straightPattern, reversedPattern, scanPool, HexDataCenter::Partials<Kernel>(buffer, today), today, buffer.scope, threshold, buffer.today->timeSpot(now))
+					: buffer.today->locateGraduatesWithoutNemesis<Kernel>(straightPattern, scanPool, HexDataCenter::Partials<Kernel>(buffer, today), today, buffer.scope, threshold, buffer.today->timeSpot(now)));
+		buffer.bestScalar = std::max(best, buffer.bestScalar);
+	}
+	
+	feedOrScan ? std::sort(buffer.posiPrecedents.begin(), buffer.posiPrecedents.end()) : std::sort(buffer.positivePrecedents.begin(), buffer.positivePrecedents.end());
+	feedOrScan ? std::sort(buffer.negaPrecedents.begin(), buffer.negaPrecedents.end()) : std::sort(buffer.negativePrecedents.begin(), buffer.negativePrecedents.end());
+}
+
+quint64 HexDataCenter::memoryUsage(void) const
+{
+	std::unordered_set<const HexDayHistory*> counted;
+	auto usage = static_cast<quint64>(0u);
+	
+	for (const auto& snapshot : HexDataCenter::resident)
+	{
+		for (const auto& day : snapshot->days)
+		{
+			if (counted.insert(day.get()).second)
+				usage += day->memoryUsage();
+		}
+	}
 	
-	feedOrScan ? std::sort(HexDataCenter::posiPrecedents.begin(), HexDataCenter::posiPrecedents.end()) : std::sort(HexDataCenter::positivePrecedents.begin(), HexDataCenter::positivePrecedents.end());
-	feedOrScan ? std::sort(HexDataCenter::negaPrecedents.begin(), HexDataCenter::negaPrecedents.end()) : std::sort(HexDataCenter::negativePrecedents.begin(), HexDataCenter::negativePrecedents.end());
+	return usage;
 }
 
-void HexDataCenter::quickStudy(qreal sl)
+template<class Kernel>
+const std::vector<HexPartialInfo>& HexDataCenter::Partials(const HexSearchBuffer& buffer, quint32 day)
 {
-	for (auto& file : HexDataCenter::posiPrecedents)
-		HexDataCenter::quickStudyFile(file, file.factor*sl);
+	static const std::vector<HexPartialInfo> none;
 	
-	for (auto& file : HexDataCenter::negaPrecedents)
-		HexDataCenter::quickStudyFile(file, file.factor*sl);
+	if constexpr(Kernel::Incremental)
+		return buffer.partialHistory[day];
+	else
+		return none;
 }
 
-void HexDataCenter::quickStudyFile(HexScanFile& file, qreal equivalentSL) const
+bool HexDataCenter::preload(const HexCancelToken& token, const QString& directory, quint32 numberOfDays, quint32 timeUnit, quint32 numberOfCandlesticks, qreal firstCoefficient)
 {
-	file.bestBuy = HexDataCenter::candlestickData[file.day].bestBuyAndSell(file.tradeTimeSpot, file.lastHigh, equivalentSL)/file.factor;
-	file.bestSell = HexDataCenter::candlestickData[file.day].bestSellAndBuy(file.tradeTimeSpot, file.lastLow, equivalentSL)/file.factor;
+	return (HexDataCenter::prepare(token, directory, numberOfDays, timeUnit, numberOfCandlesticks, firstCoefficient, false) != nullptr);
 }
 
-HexScanReport HexDataCenter::scanReport(qreal tp) const
+std::shared_ptr<const HexDataSnapshot> HexDataCenter::prepare(const HexCancelToken& token, const QString& directory, quint32 numberOfDays, quint32 timeUnit, quint32 numberOfCandlesticks, qreal firstCoefficient, bool benchmarking)
 {
-	auto report = HexScanReport(HexDataCenter::bestScalar, HexDataCenter::posiPrecedents.size() + HexDataCenter::negaPrecedents.size());
+	const auto key = directory + '_' + QString::number(numberOfDays) + '_' + QString::number(timeUnit) + 'x' + QString::number(numberOfCandlesticks) + '_' + QString::number(firstCoefficient*100.);
+	std::shared_ptr<const HexDataSnapshot> current;
+	
+	{
+		std::lock_guard<std::mutex> lock(HexDataCenter::publishing);
+		
+		const auto found = std::find_if(HexDataCenter::resident.cbegin(), HexDataCenter::resident.cend(), [&](const auto& snapshot)
+		{
+			return snapshot->matches(directory, numberOfDays, timeUnit, numberOfCandlesticks, firstCoefficient);
+		});
+		
+		if (found != HexDataCenter::resident.cend())
+			current = *found;
+	}
 	
-	for (const auto& sf : HexDataCenter::posiPrecedents)
+	if (token.isCancelled())
+		return nullptr;
+	
+	if (current != nullptr and HexDataCenter::IsCurrent(*current))
+	{
+		auto next = current;
+		
+		if (benchmarking and not current->calibrated)
+		{
+			auto calibrated = std::make_shared<HexDataSnapshot>(*current);
+			HexDataCenter::calibrate(*calibrated, true);
+			next = std::move(calibrated);
+		}
+		
+		std::lock_guard<std::mutex> lock(HexDataCenter::publishing);
+		const auto found = std::find(HexDataCenter::resident.begin(), HexDataCenter::resident.end(), current);
+		
+		if (found != HexDataCenter::resident.end())
+		{
+			*found = next;
+			HexDataCenter::resident.splice(HexDataCenter::resident.begin(), HexDataCenter::resident, found);
+		}
+		
+		return next;
+	}
+	
+	std::shared_ptr<std::promise<std::shared_ptr<const HexDataSnapshot>>> promise;
+	std::shared_future<std::shared_ptr<const HexDataSnapshot>> pending;
+	
+	{
+		std::lock_guard<std::mutex> lock(HexDataCenter::publishing);
+		const auto found = HexDataCenter::building.find(key);
+		
+		if (found != HexDataCenter::building.cend())
+			pending = found->second;
+		else
+		{
+			promise = std::make_shared<std::promise<std::shared_ptr<const HexDataSnapshot>>>();
+			HexDataCenter::building.emplace(key, promise->get_future().share());
+		}
+	}
+	
+	// Someone else is already building this snapshot: wait for it to be published, then take it from there.
+	if (promise == nullptr)
+	{
+		while (pending.wait_for(std::chrono::milliseconds(50)) != std::future_status::ready)
+		{
+			if (token.isCancelled())
+				return nullptr;
+		}
+		
+		return HexDataCenter::prepare(token, directory, numberOfDays, timeUnit, numberOfCandlesticks, firstCoefficient, benchmarking);
+	}
+	
+	const auto next = HexDataCenter::build(token, current, directory, numberOfDays, timeUnit, numberOfCandlesticks, firstCoefficient, benchmarking);
+	
+	{
+		std::lock_guard<std::mutex> lock(HexDataCenter::publishing);
+		HexDataCenter::building.erase(key);
+		
+		if (next != nullptr)
+		{
+			HexDataCenter::resident.remove(current);
+			HexDataCenter::resident.push_front(next);
+			HexDataCenter::evict();
+		}
+	}
+	
+	promise->set_value(next);
+	return next;
+}
+
+void HexDataCenter::quickStudy(HexSearchBuffer& buffer, qreal sl) const
+{
+	// Today's windows only have OutcomeHorizon candlesticks of future, so every day is held to it when today is searched.
+	const auto capped = (buffer.today != nullptr);
+	
+	for (auto& file : buffer.posiPrecedents)
+	{
+		if (buffer.token.isCancelled())
+			return;
+		
+		HexDataCenter::QuickStudyFile(buffer.day(file.day), file, file.factor*sl, capped);
+	}
+	
+	for (auto& file : buffer.negaPrecedents)
+	{
+		if (buffer.token.isCancelled())
+			return;
+		
+		HexDataCenter::QuickStudyFile(buffer.day(file.day), file, file.factor*sl, capped);
+	}
+}
+
+void HexDataCenter::QuickStudyFile(const HexDayHistory& day, HexScanFile& file, qreal equivalentSL, bool capped)
+{
+	file.bestBuy = day.bestBuyAndSell(file.tradeTimeSpot, file.lastHigh, equivalentSL, capped)/file.factor;
+	file.bestSell = day.bestSellAndBuy(file.tradeTimeSpot, file.lastLow, equivalentSL, capped)/file.factor;
+}
+
+HexScanReport HexDataCenter::scanReport(const HexSearchBuffer& buffer, qreal tp) const
+{
+	auto report = HexScanReport(buffer.bestScalar, buffer.posiPrecedents.size() + buffer.negaPrecedents.size());
+	
+	for (const auto& sf : buffer.posiPrecedents)
 	{
 		report.bestBuys.push_back(sf.bestBuy);
 		report.bestSells.push_back(sf.bestSell);
@@ -366,7 +834,7 @@ HexScanReport HexDataCenter::scanReport(qreal tp) const
 			++report.sWin;
 	}
 	
-	for (const auto& sf : HexDataCenter::negaPrecedents)
+	for (const auto& sf : buffer.negaPrecedents)
 	{
 		report.bestBuys.push_back(sf.bestSell);
 		report.bestSells.push_back(sf.bestBuy);
@@ -382,21 +850,59 @@ HexScanReport HexDataCenter::scanReport(qreal tp) const
 			++report.bWin;
 	}
 	
-	if (not HexDataCenter::posiPrecedents.empty())
-		report.worstSimilarity = HexDataCenter::posiPrecedents.back().similarity;
+	if (not buffer.posiPrecedents.empty())
+		report.worstSimilarity = buffer.posiPrecedents.back().similarity;
 	
-	if ((not HexDataCenter::negaPrecedents.empty()) and HexDataCenter::negaPrecedents.back().similarity < report.worstSimilarity)
-		report.worstSimilarity = HexDataCenter::negaPrecedents.back().similarity;
+	if ((not buffer.negaPrecedents.empty()) and buffer.negaPrecedents.back().similarity < report.worstSimilarity)
+		report.worstSimilarity = buffer.negaPrecedents.back().similarity;
 	
 	std::sort(report.bestBuys.begin(), report.bestBuys.end());
 	std::sort(report.bestSells.begin(), report.bestSells.end());
 	return report;
 }
 
-void HexDataCenter::setUpHistory(quint32 timeUnit, quint32 numberOfCandlesticks, quint32 scope)
+template<class Kernel>
+void HexDataCenter::updatePartials(HexSearchBuffer& buffer, std::vector<HexCandlestick<qreal>>::const_iterator it, quint32 timeUnit, quint32 numberOfCandlesticks) const
 {
-	for (auto& foo : candlestickData)
-		foo.setUpHistory(timeUnit, numberOfCandlesticks, scope);
+	const auto numberOfDays = buffer.numberOfDays();
+	auto query = Kernel::ExtractCandlesticks(it, timeUnit, numberOfCandlesticks);
+	std::vector<quint32> changes;
+	
+	if (buffer.partialQuery.size() == query.size())
+	{
+		for (auto i = 0u; i < query.size() and changes.size() <= HexDataCenter::IncrementalLimit; ++i)
+		{
+			if (query[i].low != buffer.partialQuery[i].low or query[i].high != buffer.partialQuery[i].high)
+				changes.push_back(i);
+		}
+	}
+	
+	if (buffer.partialQuery.size() != query.size() or changes.size() > HexDataCenter::IncrementalLimit or buffer.partialHistory.size() != numberOfDays)
+	{
+		buffer.partialHistory.resize(numberOfDays);
+		
+		for (auto day = 0u; day < numberOfDays and not buffer.token.isCancelled(); ++day)
+			buffer.day(day).setUpPartials<Kernel>(query, buffer.partialHistory[day]);
+	}
+	else
+	{
+		for (const auto index : changes)
+		{
+			const auto deltaLow = query[index].low - buffer.partialQuery[index].low;
+			const auto deltaHigh = query[index].high - buffer.partialQuery[index].high;
+			
+			for (auto day = 0u; day < numberOfDays and not buffer.token.isCancelled(); ++day)
+				buffer.day(day).updatePartials(buffer.partialHistory[day], index, deltaLow, deltaHigh);
+		}
+		
+		if (buffer.today != nullptr)
+			buffer.today->extendPartials<Kernel>(query, buffer.partialHistory.back());
+	}
+	
+	if (buffer.token.isCancelled())
+		buffer.partialQuery.clear();
+	else
+		buffer.partialQuery.swap(query);
 }
 
 void HexDataCenter::WriteReport(const std::vector<HexFullFile>& precedents, HexFullReport& report, qreal takeProfit, qreal stopLoss, bool positive)
@@ -0,0 +1,88 @@
+#ifndef __DATA_SNAPSHOT_HPP__
+#define __DATA_SNAPSHOT_HPP__
+
+// Standard Libraries
+#include <memory>
+
+// Personal Libraries
+#include "HexDayHistory.hpp"
+
+class HexDataSnapshot
+{
+	public:
+	
+		std::vector<std::shared_ptr<const HexDayHistory>>		days;
+		QStringList							files;
+		std::vector<HexFileStamp>					stamps;
+		QString								directory;
+		QString								excluded;
+		HexKernelChoice							straightChoice;
+		HexKernelChoice							nemesisChoice;
+		qreal								firstCoefficient = 1.;
+		quint64								version = 0u;
+		quint32								timeUnit = 0u;
+		quint32								numberOfCandlesticks = 0u;
+		bool								calibrated = false;
+		bool								weighted = false;
+		
+		inline const HexKernelChoice&					choice(bool) const;
+		inline std::shared_ptr<const HexDataSnapshot>			excluding(const QString&, quint32) const;
+		inline std::vector<HexCandlestick<qreal>>			getCandlesticks(const HexFullFile&) const;
+		inline bool							matches(const QString&, quint32, quint32, quint32, qreal, const QString& = QString()) const;
+		inline quint64							memoryUsage(void) const;
+};
+
+const HexKernelChoice& HexDataSnapshot::choice(bool nemesis) const
+{
+	return (nemesis ? HexDataSnapshot::nemesisChoice : HexDataSnapshot::straightChoice);
+}
+
+std::shared_ptr<const HexDataSnapshot> HexDataSnapshot::excluding(const QString& file, quint32 numberOfDays) const
+{
+	auto foo = std::make_shared<HexDataSnapshot>(*this);
+	const auto index = foo->files.indexOf(file);
+	foo->excluded = file;
+	
+	if (index >= 0)
+	{
+		foo->days.erase(foo->days.begin() + index);
+		foo->files.removeAt(index);
+		foo->stamps.erase(foo->stamps.begin() + index);
+	}
+	
+	while (foo->days.size() > numberOfDays)
+	{
+		foo->days.pop_back();
+		foo->files.removeLast();
+		foo->stamps.pop_back();
+	}
+	
+	return foo;
+}
+
+std::vector<HexCandlestick<qreal>> HexDataSnapshot::getCandlesticks(const HexFullFile& sf) const
+{
+	const auto& day = *HexDataSnapshot::days[sf.day];
+	const auto numberOfCandlesticks = (sf.tradeTimeSpot - sf.sampleTimeSpot)/sf.timeUnit;
+	
+	const auto sizeOfHistory = day.sizeOfHistory();
+	const auto numberOfCandlesticksToDraw = (sf.sampleTimeSpot + (numberOfCandlesticks*6u/5u)*sf.timeUnit < sizeOfHistory ? numberOfCandlesticks*6u/5u : numberOfCandlesticks);
+	return day.getCandlesticks(sf.sampleTimeSpot, sf.timeUnit, numberOfCandlesticksToDraw);
+}
+
+bool HexDataSnapshot::matches(const QString& dir, quint32 numberOfDays, quint32 tu, quint32 nc, qreal fc, const QString& ex) const
+{
+	return (HexDataSnapshot::directory == dir and HexDataSnapshot::days.size() == numberOfDays and HexDataSnapshot::timeUnit == tu and HexDataSnapshot::numberOfCandlesticks == nc and HexDataSnapshot::firstCoefficient == fc and HexDataSnapshot::excluded == ex);
+}
+
+quint64 HexDataSnapshot::memoryUsage(void) const
+{
+	auto usage = static_cast<quint64>(sizeof(HexDataSnapshot));
+	
+	for (const auto& day : HexDataSnapshot::days)
+		usage += day->memoryUsage();
+	
+	return usage;
+}
+
+#endif
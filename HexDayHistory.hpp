@@ -1,6 +1,9 @@
 #ifndef __DAY_HISTORY_HPP__
 #define __DAY_HISTORY_HPP__
 
+// Standard Libraries
+#include <memory>
+
 // Personal Libraries
 #include "HexCandidatePool.hpp"
 #include "HexGraduatePool.hpp"
@@ -9,47 +12,116 @@ class HexDayHistory
 {
 	private:
 	
+		static constexpr quint32							OutcomeHorizon = 1'800u;
+		static constexpr quint32							SessionCapacity = 23'400u;
+		
 		const QString									date;
-		std::vector<HexCandlestick<qreal>>						history;
+		const std::shared_ptr<const std::vector<HexCandlestick<qreal>>>			history;
+		const std::shared_ptr<std::vector<HexCandlestick<qreal>>>				session;
 		std::vector<HexNormalisedInfo>							normalisedHistory;
 		
+		qreal										firstCoefficient = 0.;
 		quint32										numberOfCandlesticks = 0u;
 		quint32										timeUnit = 0u;
-		quint32										scope = 0u;
 		
+		template<class Kernel> inline qreal						scalar(const HexNormalisedInfo&, std::vector<HexNormalisedInfo>::const_iterator, const std::vector<HexPartialInfo>&) const;
+		template<class Kernel> inline std::pair<qreal, qreal>				scalars(const HexNormalisedInfo&, const HexNormalisedInfo&, std::vector<HexNormalisedInfo>::const_iterator, const std::vector<HexPartialInfo>&) const;
+		template<class Kernel> inline void						setUpHistory(quint32, quint32, const std::vector<qreal>&);
+		inline std::vector<HexCandlestick<qreal>>::const_iterator			outcomeEnd(quint32) const;
 		inline QString									timeString(quint32) const;
 	
 	public:
-		
-		inline										HexDayHistory(const QString& str);
-		inline void									addEntry(qreal, qreal);
-		inline qreal									bestBuyAndSell(quint32, qreal, qreal) const;
-		inline qreal									bestSellAndBuy(quint32, qreal, qreal) const;
+	
+		inline										HexDayHistory(const QString&, std::shared_ptr<const std::vector<HexCandlestick<qreal>>>);
+		inline										HexDayHistory(const QString&, quint32, quint32);
+		inline										HexDayHistory(const QString&, std::shared_ptr<const std::vector<HexCandlestick<qreal>>>, std::vector<HexNormalisedInfo>&&, quint32, quint32, qreal);
+		template<class Kernel> inline quint32						benchmark(bool, quint32, qreal&) const;
+		inline qreal									bestBuyAndSell(quint32, qreal, qreal, bool) const;
+		inline qreal									bestSellAndBuy(quint32, qreal, qreal, bool) const;
+		inline const std::vector<HexCandlestick<qreal>>&					candlesticks(void) const;
+		inline const QString&								dateString(void) const;
+		template<class Kernel> inline void						extend(const std::vector<HexCandlestick<qreal>>&, quint32);
+		template<class Kernel> inline void						extendPartials(const std::vector<HexCandlestick<qreal>>&, std::vector<HexPartialInfo>&) const;
 		inline std::vector<HexCandlestick<qreal>>						getCandlesticks(quint32, quint32, quint32) const;
-		template<class FileClass> inline void						locateBestWithNemesis(const HexNormalisedInfo&, const HexNormalisedInfo&, HexCandidatePool<FileClass>&, quint32, quint32, qreal) const;
-		template<class FileClass> inline void						locateBestWithoutNemesis(const HexNormalisedInfo&, HexCandidatePool<FileClass>&, quint32, quint32, qreal) const;
-		template<class FileClass> inline qreal						locateGraduatesWithNemesis(const HexNormalisedInfo&, const HexNormalisedInfo&, HexGraduatePool<FileClass>&, quint32, qreal, qreal) const;
-		template<class FileClass> inline qreal						locateGraduatesWithoutNemesis(const HexNormalisedInfo&, HexGraduatePool<FileClass>&, quint32, qreal, qreal) const;
-		inline void									setUpHistory(quint32, quint32, quint32);
+		inline bool									isNormalised(quint32, quint32, qreal) const;
+		template<class Kernel, class FileClass> inline void				locateBestWithNemesis(const HexNormalisedInfo&, const HexNormalisedInfo&, HexCandidatePool<FileClass>&, const std::vector<HexPartialInfo>&, quint32, quint32, quint32, quint32) const;
+		template<class Kernel, class FileClass> inline void				locateBestWithoutNemesis(const HexNormalisedInfo&, HexCandidatePool<FileClass>&, const std::vector<HexPartialInfo>&, quint32, quint32, quint32, quint32) const;
+		template<class Kernel, class FileClass> inline qreal				locateGraduatesWithNemesis(const HexNormalisedInfo&, const HexNormalisedInfo&, HexGraduatePool<FileClass>&, const std::vector<HexPartialInfo>&, quint32, quint32, qreal, quint32) const;
+		template<class Kernel, class FileClass> inline qreal				locateGraduatesWithoutNemesis(const HexNormalisedInfo&, HexGraduatePool<FileClass>&, const std::vector<HexPartialInfo>&, quint32, quint32, qreal, quint32) const;
+		inline quint64									memoryUsage(void) const;
+		template<class Kernel> inline std::shared_ptr<const HexDayHistory>		normalised(quint32, quint32, const std::vector<qreal>&) const;
+		template<class Kernel> inline void						setUpPartials(const std::vector<HexCandlestick<qreal>>&, std::vector<HexPartialInfo>&) const;
 		inline quint32									sizeOfHistory(void) const;
 		inline quint32									strictBuyAndSell(quint32, qreal) const;
 		inline quint32									strictSellAndBuy(quint32, qreal) const;
+		inline quint32									timeSpot(qreal) const;
+		inline void									updatePartials(std::vector<HexPartialInfo>&, quint32, qreal, qreal) const;
+		inline const std::vector<HexNormalisedInfo>&					windows(void) const;
 };
 
-HexDayHistory::HexDayHistory(const QString& str) : date(str)
+HexDayHistory::HexDayHistory(const QString& str, std::shared_ptr<const std::vector<HexCandlestick<qreal>>> candlesticks) : date(str), history(std::move(candlesticks))
 {
-	HexDayHistory::history.reserve(23'400u);
 }
 
-void HexDayHistory::addEntry(qreal low, qreal high)
+HexDayHistory::HexDayHistory(const QString& str, quint32 tu, quint32 nc) :
+	date(str),
+	history(std::make_shared<std::vector<HexCandlestick<qreal>>>()),
+	session(std::const_pointer_cast<std::vector<HexCandlestick<qreal>>>(history)),
+	firstCoefficient(HexNormalisedInfo::FirstCoefficient()),
+	numberOfCandlesticks(nc),
+	timeUnit(tu)
 {
-	HexDayHistory::history.emplace_back(low, high);
+	HexDayHistory::session->reserve(HexDayHistory::SessionCapacity);
+	HexDayHistory::normalisedHistory.reserve(HexDayHistory::SessionCapacity);
 }
 
-qreal HexDayHistory::bestBuyAndSell(quint32 tradeTimeSpot, qreal buyPrice, qreal stopLoss) const
+HexDayHistory::HexDayHistory(const QString& str, std::shared_ptr<const std::vector<HexCandlestick<qreal>>> candlesticks, std::vector<HexNormalisedInfo>&& infos, quint32 tu, quint32 nc, qreal fc) :
+	date(str),
+	history(std::move(candlesticks)),
+	normalisedHistory(std::move(infos)),
+	firstCoefficient(fc),
+	numberOfCandlesticks(nc),
+	timeUnit(tu)
 {
-	const auto end = HexDayHistory::history.cend();
-	auto it = HexDayHistory::history.cbegin() + tradeTimeSpot;
+}
+
+template<class Kernel>
+quint32 HexDayHistory::benchmark(bool nemesis, quint32 limit, qreal& checksum) const
+{
+	if (HexDayHistory::normalisedHistory.empty())
+		return 0u;
+	
+	const auto& straightPattern = HexDayHistory::normalisedHistory[HexDayHistory::normalisedHistory.size()/2u];
+	const auto reversedPattern = HexNormalisedInfo::Reversed(straightPattern);
+	
+	const auto end = (limit < HexDayHistory::normalisedHistory.size() ? HexDayHistory::normalisedHistory.cbegin() + limit : HexDayHistory::normalisedHistory.cend());
+	auto count = 0u;
+	
+	if (nemesis)
+	{
+		for (auto it = HexDayHistory::normalisedHistory.cbegin(); it != end; ++it)
+		{
+			const auto [scalar1, scalar2] = straightPattern.scalars<Kernel>(reversedPattern, *it);
+			checksum += std::max(scalar1, scalar2);
+			++count;
+		}
+	}
+	else
+	{
+		for (auto it = HexDayHistory::normalisedHistory.cbegin(); it != end; ++it)
+		{
+			checksum += straightPattern.scalar<Kernel>(*it);
+			++count;
+		}
+	}
+	
+	return count;
+}
+
+qreal HexDayHistory::bestBuyAndSell(quint32 tradeTimeSpot, qreal buyPrice, qreal stopLoss, bool capped) const
+{
+	const auto end = (capped ? HexDayHistory::outcomeEnd(tradeTimeSpot) : HexDayHistory::history->cend());
+	auto it = HexDayHistory::history->cbegin() + tradeTimeSpot;
 	
 	const auto pricelimit = buyPrice - stopLoss;
 	auto max = buyPrice;
@@ -65,10 +137,10 @@ qreal HexDayHistory::bestBuyAndSell(quint32 tradeTimeSpot, qreal buyPrice, qreal
 	return (max - buyPrice);
 }
 
-qreal HexDayHistory::bestSellAndBuy(quint32 tradeTimeSpot, qreal sellPrice, qreal stopLoss) const
+qreal HexDayHistory::bestSellAndBuy(quint32 tradeTimeSpot, qreal sellPrice, qreal stopLoss, bool capped) const
 {
-	const auto end = HexDayHistory::history.cend();
-	auto it = HexDayHistory::history.cbegin() + tradeTimeSpot;
+	const auto end = (capped ? HexDayHistory::outcomeEnd(tradeTimeSpot) : HexDayHistory::history->cend());
+	auto it = HexDayHistory::history->cbegin() + tradeTimeSpot;
 	
 	const auto pricelimit = sellPrice + stopLoss;
 	auto min = sellPrice;
@@ -84,45 +156,57 @@ qreal HexDayHistory::bestSellAndBuy(quint32 tradeTimeSpot, qreal sellPrice, qrea
 	return (sellPrice - min);
 }
 
-std::vector<HexCandlestick<qreal>> HexDayHistory::getCandlesticks(quint32 start, quint32 timeUnit, quint32 numberOfCandlesticks) const
+const std::vector<HexCandlestick<qreal>>& HexDayHistory::candlesticks(void) const
+{
+	return *HexDayHistory::history;
+}
+
+const QString& HexDayHistory::dateString(void) const
 {
-	auto it = HexDayHistory::history.cbegin() + start;
-	std::vector<HexCandlestick<qreal>> foo;
-	foo.reserve(numberOfCandlesticks);
+	return HexDayHistory::date;
+}
+
+template<class Kernel>
+void HexDayHistory::extend(const std::vector<HexCandlestick<qreal>>& candlesticks, quint32 end)
+{
+	if (HexDayHistory::session == nullptr or end <= HexDayHistory::session->size())
+		return;
 	
-	for (auto i = 0u; i < numberOfCandlesticks; ++i)
-	{
-		auto& c = foo.emplace_back(it->low, it->high);
-		++it;
-		
-		for (auto j = 1u; j < timeUnit; ++j)
-		{
-			if (it->low < c.low)
-				c.low = it->low;
-			
-			if (it->high > c.high)
-				c.high = it->high;
-			
-			++it;
-		}
-	}
+	HexDayHistory::session->insert(HexDayHistory::session->end(), candlesticks.cbegin() + HexDayHistory::session->size(), candlesticks.cbegin() + end);
+	
+	const auto numberOfElementaryCandlesticks = HexDayHistory::timeUnit*HexDayHistory::numberOfCandlesticks;
 	
-	return foo;
+	while (HexDayHistory::normalisedHistory.size() + numberOfElementaryCandlesticks + HexDayHistory::OutcomeHorizon <= HexDayHistory::session->size())
+		HexDayHistory::normalisedHistory.emplace_back(Kernel(), HexDayHistory::session->cbegin() + HexDayHistory::normalisedHistory.size(), HexDayHistory::timeUnit, HexDayHistory::numberOfCandlesticks);
+}
+
+template<class Kernel>
+void HexDayHistory::extendPartials(const std::vector<HexCandlestick<qreal>>& query, std::vector<HexPartialInfo>& partials) const
+{
+	for (auto i = partials.size(); i < HexDayHistory::normalisedHistory.size(); ++i)
+		partials.push_back(HexDayHistory::normalisedHistory[i].partials<Kernel>(query));
+}
+
+std::vector<HexCandlestick<qreal>> HexDayHistory::getCandlesticks(quint32 start, quint32 timeUnit, quint32 numberOfCandlesticks) const
+{
+	return HexKernel<0u>::ExtractCandlesticks(HexDayHistory::history->cbegin() + start, timeUnit, numberOfCandlesticks);
+}
+
+bool HexDayHistory::isNormalised(quint32 tu, quint32 nc, qreal fc) const
+{
+	return (HexDayHistory::timeUnit == tu and HexDayHistory::numberOfCandlesticks == nc and HexDayHistory::firstCoefficient == fc);
 }
 
-template<class FileClass>
-void HexDayHistory::locateBestWithNemesis(const HexNormalisedInfo& straightPattern, const HexNormalisedInfo& reversedPattern, HexCandidatePool<FileClass>& pool, quint32 day, quint32 numberOfCandidates, qreal now) const
+template<class Kernel, class FileClass>
+void HexDayHistory::locateBestWithNemesis(const HexNormalisedInfo& straightPattern, const HexNormalisedInfo& reversedPattern, HexCandidatePool<FileClass>& pool, const std::vector<HexPartialInfo>& partials, quint32 day, quint32 numberOfCandidates, quint32 scope, quint32 realTimeSpot) const
 {
 	const auto numberOfElementaryCandlesticks = HexDayHistory::timeUnit*HexDayHistory::numberOfCandlesticks;
-	const auto realTimeSpot = static_cast<quint32>(now*static_cast<qreal>(HexDayHistory::history.size()));
-	
-	const auto iFile = HexIterationFile(HexDayHistory::normalisedHistory, (now < 0. or now > 1. ? 50'000u : realTimeSpot), HexDayHistory::scope, numberOfElementaryCandlesticks);
+	const auto iFile = HexIterationFile(HexDayHistory::normalisedHistory, realTimeSpot, scope, numberOfElementaryCandlesticks);
 	auto tradeTimeSpot = iFile.sampleTimeSpot + numberOfElementaryCandlesticks;
 	
 	for (auto it = HexDayHistory::normalisedHistory.cbegin() + iFile.sampleTimeSpot; it != iFile.end; ++it)
 	{
-		const auto scalar1 = straightPattern.scalar(*it);
-		const auto scalar2 = reversedPattern.scalar(*it);
+		const auto [scalar1, scalar2] = HexDayHistory::scalars<Kernel>(straightPattern, reversedPattern, it, partials);
 		
 		if (scalar1 >= scalar2)
 		{
@@ -158,18 +242,16 @@ void HexDayHistory::locateBestWithNemesis(const HexNormalisedInfo& straightPatte
 	}
 }
 
-template<class FileClass>
-void HexDayHistory::locateBestWithoutNemesis(const HexNormalisedInfo& straightPattern, HexCandidatePool<FileClass>& pool, quint32 day, quint32 numberOfCandidates, qreal now) const
+template<class Kernel, class FileClass>
+void HexDayHistory::locateBestWithoutNemesis(const HexNormalisedInfo& straightPattern, HexCandidatePool<FileClass>& pool, const std::vector<HexPartialInfo>& partials, quint32 day, quint32 numberOfCandidates, quint32 scope, quint32 realTimeSpot) const
 {
 	const auto numberOfElementaryCandlesticks = HexDayHistory::timeUnit*HexDayHistory::numberOfCandlesticks;
-	const auto realTimeSpot = static_cast<quint32>(now*static_cast<qreal>(HexDayHistory::history.size()));
-	
-	const auto iFile = HexIterationFile(HexDayHistory::normalisedHistory, (now < 0. or now > 1. ? 50'000u : realTimeSpot), HexDayHistory::scope, numberOfElementaryCandlesticks);
+	const auto iFile = HexIterationFile(HexDayHistory::normalisedHistory, realTimeSpot, scope, numberOfElementaryCandlesticks);
 	auto tradeTimeSpot = iFile.sampleTimeSpot + numberOfElementaryCandlesticks;
 	
 	for (auto it = HexDayHistory::normalisedHistory.cbegin() + iFile.sampleTimeSpot; it != iFile.end; ++it)
 	{
-		const auto scalar = straightPattern.scalar(*it);
+		const auto scalar = HexDayHistory::scalar<Kernel>(straightPattern, it, partials);
 		
 		if (pool.numberOfResults() < numberOfCandidates or pool.worstSimilarity() < scalar)
 		{
@@ -189,20 +271,17 @@ void HexDayHistory::locateBestWithoutNemesis(const HexNormalisedInfo& straightPa
 	}
 }
 
-template<class FileClass>
-qreal HexDayHistory::locateGraduatesWithNemesis(const HexNormalisedInfo& straightPattern, const HexNormalisedInfo& reversedPattern, HexGraduatePool<FileClass>& pool, quint32 day, qreal threshold, qreal now) const
+template<class Kernel, class FileClass>
+qreal HexDayHistory::locateGraduatesWithNemesis(const HexNormalisedInfo& straightPattern, const HexNormalisedInfo& reversedPattern, HexGraduatePool<FileClass>& pool, const std::vector<HexPartialInfo>& partials, quint32 day, quint32 scope, qreal threshold, quint32 realTimeSpot) const
 {
 	const auto numberOfElementaryCandlesticks = HexDayHistory::timeUnit*HexDayHistory::numberOfCandlesticks;
-	const auto realTimeSpot = static_cast<quint32>(now*static_cast<qreal>(HexDayHistory::history.size()));
-	
-	const auto iFile = HexIterationFile(HexDayHistory::normalisedHistory, (now < 0. or now > 1. ? 50'000u : realTimeSpot), HexDayHistory::scope, numberOfElementaryCandlesticks);
+	const auto iFile = HexIterationFile(HexDayHistory::normalisedHistory, realTimeSpot, scope, numberOfElementaryCandlesticks);
 	auto tradeTimeSpot = iFile.sampleTimeSpot + numberOfElementaryCandlesticks;
 	auto best = 0.;
 	
 	for (auto it = HexDayHistory::normalisedHistory.cbegin() + iFile.sampleTimeSpot; it != iFile.end; ++it)
 	{
-		const auto scalar1 = straightPattern.scalar(*it);
-		const auto scalar2 = reversedPattern.scalar(*it);
+		const auto [scalar1, scalar2] = HexDayHistory::scalars<Kernel>(straightPattern, reversedPattern, it, partials);
 		best = std::max(std::max(scalar1, scalar2), best);
 		
 		if (scalar1 >= scalar2)
@@ -241,19 +320,17 @@ qreal HexDayHistory::locateGraduatesWithNemesis(const HexNormalisedInfo& straigh
 	return best;
 }
 
-template<class FileClass>
-qreal HexDayHistory::locateGraduatesWithoutNemesis(const HexNormalisedInfo& straightPattern, HexGraduatePool<FileClass>& pool, quint32 day, qreal threshold, qreal now) const
+template<class Kernel, class FileClass>
+qreal HexDayHistory::locateGraduatesWithoutNemesis(const HexNormalisedInfo& straightPattern, HexGraduatePool<FileClass>& pool, const std::vector<HexPartialInfo>& partials, quint32 day, quint32 scope, qreal threshold, quint32 realTimeSpot) const
 {
 	const auto numberOfElementaryCandlesticks = HexDayHistory::timeUnit*HexDayHistory::numberOfCandlesticks;
-	const auto realTimeSpot = static_cast<quint32>(now*static_cast<qreal>(HexDayHistory::history.size()));
-	
-	const auto iFile = HexIterationFile(HexDayHistory::normalisedHistory, (now < 0. or now > 1. ? 50'000u : realTimeSpot), HexDayHistory::scope, numberOfElementaryCandlesticks);
+	const auto iFile = HexIterationFile(HexDayHistory::normalisedHistory, realTimeSpot, scope, numberOfElementaryCandlesticks);
 	auto tradeTimeSpot = iFile.sampleTimeSpot + numberOfElementaryCandlesticks;
 	auto best = 0.;
 	
 	for (auto it = HexDayHistory::normalisedHistory.cbegin() + iFile.sampleTimeSpot; it != iFile.end; ++it)
 	{
-		const auto scalar = straightPattern.scalar(*it);
+		const auto scalar = HexDayHistory::scalar<Kernel>(straightPattern, it, partials);
 		best = std::max(scalar, best);
 		
 		if (scalar >= threshold)
@@ -276,43 +353,88 @@ qreal HexDayHistory::locateGraduatesWithoutNemesis(const HexNormalisedInfo& stra
 	return best;
 }
 
-void HexDayHistory::setUpHistory(quint32 tu, quint32 nc, quint32 sc)
+quint64 HexDayHistory::memoryUsage(void) const
+{
+	const auto raw = HexDayHistory::history->capacity()*sizeof(HexCandlestick<qreal>);
+	const auto normalised = HexDayHistory::normalisedHistory.capacity()*(sizeof(HexNormalisedInfo) + HexDayHistory::numberOfCandlesticks*sizeof(HexCandlestick<qreal>));
+	return sizeof(HexDayHistory) + raw + normalised;
+}
+
+template<class Kernel>
+std::shared_ptr<const HexDayHistory> HexDayHistory::normalised(quint32 tu, quint32 nc, const std::vector<qreal>& coefficients) const
+{
+	auto day = std::make_shared<HexDayHistory>(HexDayHistory::date, HexDayHistory::history);
+	day->setUpHistory<Kernel>(tu, nc, coefficients);
+	return day;
+}
+
+std::vector<HexCandlestick<qreal>>::const_iterator HexDayHistory::outcomeEnd(quint32 tradeTimeSpot) const
+{
+	const auto left = static_cast<quint32>(HexDayHistory::history->size()) - tradeTimeSpot;
+	return HexDayHistory::history->cbegin() + tradeTimeSpot + std::min(left, HexDayHistory::OutcomeHorizon);
+}
+
+template<class Kernel>
+qreal HexDayHistory::scalar(const HexNormalisedInfo& straightPattern, std::vector<HexNormalisedInfo>::const_iterator it, const std::vector<HexPartialInfo>& partials) const
+{
+	if constexpr(Kernel::Incremental)
+		return straightPattern.scalars(partials[it - HexDayHistory::normalisedHistory.cbegin()]).first;
+	else
+		return straightPattern.scalar<Kernel>(*it);
+}
+
+template<class Kernel>
+std::pair<qreal, qreal> HexDayHistory::scalars(const HexNormalisedInfo& straightPattern, const HexNormalisedInfo& reversedPattern, std::vector<HexNormalisedInfo>::const_iterator it, const std::vector<HexPartialInfo>& partials) const
+{
+	if constexpr(Kernel::Incremental)
+		return straightPattern.scalars(partials[it - HexDayHistory::normalisedHistory.cbegin()]);
+	else
+		return straightPattern.scalars<Kernel>(reversedPattern, *it);
+}
+
+template<class Kernel>
+void HexDayHistory::setUpHistory(quint32 tu, quint32 nc, const std::vector<qreal>& coefficients)
 {
-	HexDayHistory::scope = sc;
-	
-	if (HexDayHistory::timeUnit == tu and HexDayHistory::numberOfCandlesticks == nc)
-		return;
-	
 	const auto numberOfElementaryCandlesticks = nc*tu;
+	HexDayHistory::firstCoefficient = coefficients[0u];
 	HexDayHistory::numberOfCandlesticks = nc;
 	HexDayHistory::timeUnit = tu;
 	
-	if (HexDayHistory::history.size() < numberOfElementaryCandlesticks)
+	if (HexDayHistory::history->size() < numberOfElementaryCandlesticks)
 		return;
 	
-	const auto size = HexDayHistory::history.size();
+	const auto size = HexDayHistory::history->size();
 	const auto timeSpotLimit = size - numberOfElementaryCandlesticks;
-	auto it = HexDayHistory::history.cbegin();
+	auto it = HexDayHistory::history->cbegin();
 	
-	HexDayHistory::normalisedHistory.clear();
 	HexDayHistory::normalisedHistory.reserve(timeSpotLimit);
 	
 	for (auto sampleTimeSpot = 0u; sampleTimeSpot < timeSpotLimit; ++sampleTimeSpot)
 	{
-		HexDayHistory::normalisedHistory.emplace_back(it, timeUnit, numberOfCandlesticks);
+		HexDayHistory::normalisedHistory.emplace_back(Kernel(), it, timeUnit, numberOfCandlesticks, coefficients.data());
 		++it;
 	}
 }
 
+template<class Kernel>
+void HexDayHistory::setUpPartials(const std::vector<HexCandlestick<qreal>>& query, std::vector<HexPartialInfo>& partials) const
+{
+	partials.clear();
+	partials.reserve(HexDayHistory::normalisedHistory.size());
+	
+	for (const auto& info : HexDayHistory::normalisedHistory)
+		partials.push_back(info.partials<Kernel>(query));
+}
+
 quint32 HexDayHistory::sizeOfHistory(void) const
 {
-	return HexDayHistory::history.size();
+	return HexDayHistory::history->size();
 }
 
 quint32 HexDayHistory::strictBuyAndSell(quint32 tradeTimeSpot, qreal goal) const
 {
-	const auto end = HexDayHistory::history.cend();
-	auto it = HexDayHistory::history.cbegin() + tradeTimeSpot;
+	const auto end = HexDayHistory::history->cend();
+	auto it = HexDayHistory::history->cbegin() + tradeTimeSpot;
 	auto count = 0u;
 	
 	while (it != end and it->high < goal)
@@ -326,8 +448,8 @@ quint32 HexDayHistory::strictBuyAndSell(quint32 tradeTimeSpot, qreal goal) const
 
 quint32 HexDayHistory::strictSellAndBuy(quint32 tradeTimeSpot, qreal goal) const
 {
-	const auto end = HexDayHistory::history.cend();
-	auto it = HexDayHistory::history.cbegin() + tradeTimeSpot;
+	const auto end = HexDayHistory::history->cend();
+	auto it = HexDayHistory::history->cbegin() + tradeTimeSpot;
 	auto count = 0u;
 	
 	while (it != end and goal < it->low)
@@ -339,9 +461,21 @@ quint32 HexDayHistory::strictSellAndBuy(quint32 tradeTimeSpot, qreal goal) const
 	return (it != end and it->low <= goal ? count : 50'000u);
 }
 
+quint32 HexDayHistory::timeSpot(qreal now) const
+{
+	if (now < 0. or now > 1.)
+		return 50'000u;
+	
+	// A growing session is only as long as the candlesticks received so far, its latest one is the present.
+	if (HexDayHistory::session != nullptr)
+		return static_cast<quint32>(HexDayHistory::history->size());
+	
+	return static_cast<quint32>(now*static_cast<qreal>(HexDayHistory::history->size()));
+}
+
 QString HexDayHistory::timeString(quint32 timeSpot) const
 {
-	const auto timestamp = timeSpot*23'400u/HexDayHistory::history.size();
+	const auto timestamp = timeSpot*23'400u/HexDayHistory::history->size();
 	const auto hour = 15u + (timestamp + 1'800u)/3'600u;
 	const auto minute = (timestamp/60u + 30u) % 60u;
 	const auto second = timestamp % 60u;
@@ -351,4 +485,15 @@ QString HexDayHistory::timeString(quint32 timeSpot) const
 	return QString::number(hour) + ':' + zeroPadding1 + QString::number(minute) + ':' + zeroPadding2 + QString::number(second);
 }
 
+void HexDayHistory::updatePartials(std::vector<HexPartialInfo>& partials, quint32 index, qreal deltaLow, qreal deltaHigh) const
+{
+	for (auto i = 0u; i < partials.size(); ++i)
+		HexDayHistory::normalisedHistory[i].correct(partials[i], index, deltaLow, deltaHigh);
+}
+
+const std::vector<HexNormalisedInfo>& HexDayHistory::windows(void) const
+{
+	return HexDayHistory::normalisedHistory;
+}
+
 #endif
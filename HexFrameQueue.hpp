@@ -0,0 +1,79 @@
+#ifndef __FRAME_QUEUE_HPP__
+#define __FRAME_QUEUE_HPP__
+
+// Qt Libraries
+#include <QtGlobal>
+
+// Standard Libraries
+#include <array>
+#include <atomic>
+
+template<class FrameClass>
+class HexFrameQueue
+{
+	private:
+	
+		static constexpr quint32	FreshBit = 4u;
+		static constexpr quint32	IndexMask = 3u;
+		
+		std::array<FrameClass, 3u>	frames;
+		std::atomic<quint32>		middle = 1u;
+		quint32				back = 0u;
+		quint32				front = 2u;
+	
+	public:
+	
+		inline FrameClass&		current(void);
+		inline FrameClass&		next(void);
+		inline bool			pending(void) const;
+		inline bool			pop(void);
+		inline bool			push(void);
+		inline void			reset(void);
+};
+
+template<class FrameClass>
+FrameClass& HexFrameQueue<FrameClass>::current(void)
+{
+	return HexFrameQueue::frames[HexFrameQueue::front];
+}
+
+template<class FrameClass>
+FrameClass& HexFrameQueue<FrameClass>::next(void)
+{
+	return HexFrameQueue::frames[HexFrameQueue::back];
+}
+
+template<class FrameClass>
+bool HexFrameQueue<FrameClass>::pending(void) const
+{
+	return ((HexFrameQueue::middle.load(std::memory_order_acquire) & HexFrameQueue::FreshBit) != 0u);
+}
+
+template<class FrameClass>
+bool HexFrameQueue<FrameClass>::pop(void)
+{
+	if ((HexFrameQueue::middle.load(std::memory_order_acquire) & HexFrameQueue::FreshBit) == 0u)
+		return false;
+	
+	const auto previous = HexFrameQueue::middle.exchange(HexFrameQueue::front, std::memory_order_acq_rel);
+	HexFrameQueue::front = previous & HexFrameQueue::IndexMask;
+	return true;
+}
+
+template<class FrameClass>
+bool HexFrameQueue<FrameClass>::push(void)
+{
+	const auto previous = HexFrameQueue::middle.exchange(HexFrameQueue::back | HexFrameQueue::FreshBit, std::memory_order_acq_rel);
+	HexFrameQueue::back = previous & HexFrameQueue::IndexMask;
+	return ((previous & HexFrameQueue::FreshBit) != 0u);
+}
+
+template<class FrameClass>
+void HexFrameQueue<FrameClass>::reset(void)
+{
+	HexFrameQueue::middle.store(1u, std::memory_order_relaxed);
+	HexFrameQueue::back = 0u;
+	HexFrameQueue::front = 2u;
+}
+
+#endif
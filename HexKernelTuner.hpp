@@ -0,0 +1,123 @@
+#ifndef __KERNEL_TUNER_HPP__
+#define __KERNEL_TUNER_HPP__
+
+// Qt Libraries
+#include <QCoreApplication>
+#include <QFile>
+#include <QTextStream>
+
+// Standard Libraries
+#include <iostream>
+#include <map>
+
+// Personal Libraries
+#include "OtherClasses.hpp"
+
+class HexKernelTuner
+{
+	private:
+	
+		static const QString				FileName;
+		
+		inline static quint32				Key(quint32, bool, bool);
+		
+		const QString					filePath;
+		std::map<quint32, HexKernelChoice>		choices;
+		bool						modified;
+		
+		inline void					load(void);
+	
+	public:
+	
+		inline						HexKernelTuner(void);
+		inline						~HexKernelTuner(void);
+		inline HexKernelChoice				choice(quint32, bool, bool) const;
+		inline bool					contains(quint32, bool, bool) const;
+		inline void					record(quint32, bool, bool, const HexKernelChoice&);
+		inline void					save(void);
+};
+
+HexKernelTuner::HexKernelTuner(void) :
+	filePath(QCoreApplication::applicationDirPath() + '/' + HexKernelTuner::FileName),
+	modified(false)
+{
+	HexKernelTuner::load();
+}
+
+HexKernelTuner::~HexKernelTuner(void)
+{
+	HexKernelTuner::save();
+}
+
+HexKernelChoice HexKernelTuner::choice(quint32 numberOfCandlesticks, bool weighted, bool nemesis) const
+{
+	const auto it = HexKernelTuner::choices.find(HexKernelTuner::Key(numberOfCandlesticks, weighted, nemesis));
+	return (it != HexKernelTuner::choices.cend() ? it->second : HexKernelChoice());
+}
+
+bool HexKernelTuner::contains(quint32 numberOfCandlesticks, bool weighted, bool nemesis) const
+{
+	return HexKernelTuner::choices.contains(HexKernelTuner::Key(numberOfCandlesticks, weighted, nemesis));
+}
+
+// Best and graduates searches evaluate the same scalar product per window and only differ in how
+// candidates are pooled, so the fastest kernel does not depend on it, nor on timeUnit, numberOfDays or scope.
+quint32 HexKernelTuner::Key(quint32 numberOfCandlesticks, bool weighted, bool nemesis)
+{
+	return 4u*numberOfCandlesticks + (weighted ? 2u : 0u) + (nemesis ? 1u : 0u);
+}
+
+void HexKernelTuner::load(void)
+{
+	QFile tunerFile(HexKernelTuner::filePath);
+	
+	if (!tunerFile.open(QIODevice::ReadOnly | QIODevice::Text))
+		return;
+	
+	QTextStream fileReader(&tunerFile);
+	
+	while (!fileReader.atEnd())
+	{
+		const auto numbers = fileReader.readLine().split(' ');
+		
+		if (numbers.size() != 3u)
+			continue;
+		
+		const auto strategy = numbers[1u].toUInt();
+		
+		if (strategy > static_cast<quint32>(KernelEnum::Paired))
+			continue;
+		
+		auto& choice = HexKernelTuner::choices[numbers[0u].toUInt()];
+		choice.strategy = static_cast<KernelEnum>(strategy);
+		choice.throughput = numbers[2u].toDouble();
+	}
+}
+
+void HexKernelTuner::record(quint32 numberOfCandlesticks, bool weighted, bool nemesis, const HexKernelChoice& choice)
+{
+	HexKernelTuner::choices[HexKernelTuner::Key(numberOfCandlesticks, weighted, nemesis)] = choice;
+	HexKernelTuner::modified = true;
+}
+
+void HexKernelTuner::save(void)
+{
+	if (not HexKernelTuner::modified)
+		return;
+	
+	QFile tunerFile(HexKernelTuner::filePath);
+	
+	if (!tunerFile.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+	{
+		std::cout << "Could not write file [" << HexKernelTuner::filePath.toStdString() + "]." << std::endl;
+		return;
+	}
+	
+	QTextStream fileWriter(&tunerFile);
+	HexKernelTuner::modified = false;
+	
+	for (const auto& [key, choice] : HexKernelTuner::choices)
+		fileWriter << key << ' ' << static_cast<quint32>(choice.strategy) << ' ' << choice.throughput << '\n';
+}
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef __PREVIEW_CACHE_HPP__
+#define __PREVIEW_CACHE_HPP__
+
+// Qt Libraries
+#include <QThread>
+
+// Standard Libraries
+#include <atomic>
+
+// Personal Libraries
+#include "HexSearchBuffer.hpp"
+
+class HexPreviewCache
+{
+	private:
+	
+		const HexSearchBuffer&						results;
+		std::shared_ptr<const HexDataSnapshot>				snapshot;
+		std::vector<HexFullFile>					positives;
+		std::vector<HexFullFile>					negatives;
+		std::vector<std::vector<HexCandlestick<qreal>>>			positiveCandlesticks;
+		std::vector<std::vector<HexCandlestick<qreal>>>			negativeCandlesticks;
+		std::atomic<quint32>						numberOfReadyPositives = 0u;
+		std::atomic<quint32>						numberOfReadyNegatives = 0u;
+		std::atomic<bool>						cancelled = false;
+		QThread*							worker = nullptr;
+		
+		inline void							run(void);
+	
+	public:
+	
+		inline								HexPreviewCache(const HexSearchBuffer&);
+		inline								~HexPreviewCache(void);
+		inline const std::vector<HexCandlestick<qreal>>*		find(qint32, bool) const;
+		inline void							prepare(void);
+		inline void							stop(void);
+};
+
+HexPreviewCache::HexPreviewCache(const HexSearchBuffer& foo) : results(foo)
+{
+}
+
+HexPreviewCache::~HexPreviewCache(void)
+{
+	HexPreviewCache::stop();
+}
+
+const std::vector<HexCandlestick<qreal>>* HexPreviewCache::find(qint32 column, bool positive) const
+{
+	const auto index = static_cast<quint32>(column);
+	const auto ready = (positive ? HexPreviewCache::numberOfReadyPositives.load(std::memory_order_acquire) : HexPreviewCache::numberOfReadyNegatives.load(std::memory_order_acquire));
+	
+	if (column < 0 or index >= ready)
+		return nullptr;
+	
+	return &(positive ? HexPreviewCache::positiveCandlesticks[index] : HexPreviewCache::negativeCandlesticks[index]);
+}
+
+void HexPreviewCache::prepare(void)
+{
+	HexPreviewCache::stop();
+	
+	HexPreviewCache::snapshot = HexPreviewCache::results.snapshot;
+	HexPreviewCache::positives = HexPreviewCache::results.positivePrecedents;
+	HexPreviewCache::negatives = HexPreviewCache::results.negativePrecedents;
+	HexPreviewCache::positiveCandlesticks.assign(HexPreviewCache::positives.size(), std::vector<HexCandlestick<qreal>>());
+	HexPreviewCache::negativeCandlesticks.assign(HexPreviewCache::negatives.size(), std::vector<HexCandlestick<qreal>>());
+	
+	if (HexPreviewCache::positives.empty() and HexPreviewCache::negatives.empty())
+		return;
+	
+	HexPreviewCache::cancelled.store(false, std::memory_order_relaxed);
+	HexPreviewCache::worker = QThread::create([this](){ HexPreviewCache::run(); });
+	HexPreviewCache::worker->start(QThread::LowPriority);
+}
+
+void HexPreviewCache::run(void)
+{
+	const auto size = std::max(HexPreviewCache::positives.size(), HexPreviewCache::negatives.size());
+	
+	for (auto i = 0u; i < size and not HexPreviewCache::cancelled.load(std::memory_order_relaxed); ++i)
+	{
+		if (i < HexPreviewCache::positives.size())
+		{
+			HexPreviewCache::positiveCandlesticks[i] = HexPreviewCache::snapshot->getCandlesticks(HexPreviewCache::positives[i]);
+			HexPreviewCache::numberOfReadyPositives.store(i + 1u, std::memory_order_release);
+		}
+		
+		if (i < HexPreviewCache::negatives.size())
+		{
+			HexPreviewCache::negativeCandlesticks[i] = HexPreviewCache::snapshot->getCandlesticks(HexPreviewCache::negatives[i]);
+			HexPreviewCache::numberOfReadyNegatives.store(i + 1u, std::memory_order_release);
+		}
+	}
+}
+
+void HexPreviewCache::stop(void)
+{
+	HexPreviewCache::cancelled.store(true, std::memory_order_relaxed);
+	
+	if (HexPreviewCache::worker != nullptr)
+	{
+		HexPreviewCache::worker->wait();
+		delete HexPreviewCache::worker;
+		HexPreviewCache::worker = nullptr;
+	}
+	
+	HexPreviewCache::numberOfReadyPositives.store(0u, std::memory_order_relaxed);
+	HexPreviewCache::numberOfReadyNegatives.store(0u, std::memory_order_relaxed);
+}
+
+#endif
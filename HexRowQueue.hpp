@@ -0,0 +1,85 @@
+#ifndef __ROW_QUEUE_HPP__
+#define __ROW_QUEUE_HPP__
+
+// Qt Libraries
+#include <QtGlobal>
+
+// Standard Libraries
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <type_traits>
+#include <vector>
+
+template<class RowClass>
+class HexRowQueue
+{
+	static_assert(std::is_trivially_copyable_v<RowClass>);
+	
+	private:
+	
+		std::vector<RowClass>		rows;
+		quint32				mask;
+		alignas(64) std::atomic<quint32>	head = 0u;
+		alignas(64) std::atomic<quint32>	tail = 0u;
+		std::atomic<quint64>		drops = 0u;
+	
+	public:
+	
+		inline				HexRowQueue(quint32);
+		inline void			clear(void);
+		inline quint32			pop(RowClass*, quint32);
+		inline bool			push(const RowClass&);
+		inline quint64			takeDrops(void);
+};
+
+template<class RowClass>
+HexRowQueue<RowClass>::HexRowQueue(quint32 capacity) :
+	rows(std::bit_ceil(capacity)),
+	mask(std::bit_ceil(capacity) - 1u)
+{
+}
+
+template<class RowClass>
+void HexRowQueue<RowClass>::clear(void)
+{
+	HexRowQueue::head.store(HexRowQueue::tail.load(std::memory_order_acquire), std::memory_order_release);
+	HexRowQueue::drops.store(0u, std::memory_order_relaxed);
+}
+
+template<class RowClass>
+quint32 HexRowQueue<RowClass>::pop(RowClass* destination, quint32 maximum)
+{
+	const auto first = HexRowQueue::head.load(std::memory_order_relaxed);
+	const auto count = std::min(HexRowQueue::tail.load(std::memory_order_acquire) - first, maximum);
+	
+	for (auto i = 0u; i < count; ++i)
+		destination[i] = HexRowQueue::rows[(first + i) & HexRowQueue::mask];
+	
+	HexRowQueue::head.store(first + count, std::memory_order_release);
+	return count;
+}
+
+template<class RowClass>
+bool HexRowQueue<RowClass>::push(const RowClass& row)
+{
+	const auto last = HexRowQueue::tail.load(std::memory_order_relaxed);
+	
+	if (last - HexRowQueue::head.load(std::memory_order_acquire) > HexRowQueue::mask)
+	{
+		HexRowQueue::drops.fetch_add(1u, std::memory_order_relaxed);
+		return false;
+	}
+	
+	HexRowQueue::rows[last & HexRowQueue::mask] = row;
+	HexRowQueue::tail.store(last + 1u, std::memory_order_release);
+	return true;
+}
+
+template<class RowClass>
+quint64 HexRowQueue<RowClass>::takeDrops(void)
+{
+	return HexRowQueue::drops.exchange(0u, std::memory_order_relaxed);
+}
+
+#endif
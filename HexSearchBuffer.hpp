@@ -0,0 +1,56 @@
+#ifndef __SEARCH_BUFFER_HPP__
+#define __SEARCH_BUFFER_HPP__
+
+// Personal Libraries
+#include "HexDataSnapshot.hpp"
+
+class HexSearchBuffer
+{
+	public:
+	
+		std::shared_ptr<const HexDataSnapshot>			snapshot;
+		std::shared_ptr<const HexDayHistory>			today;
+		std::vector<HexScanFile>				posiPrecedents;
+		std::vector<HexScanFile>				negaPrecedents;
+		std::vector<HexFullFile>				positivePrecedents;
+		std::vector<HexFullFile>				negativePrecedents;
+		std::vector<HexCandlestick<qreal>>			partialQuery;
+		std::vector<std::vector<HexPartialInfo>>		partialHistory;
+		HexCancelToken						token;
+		
+		quint32							scope = 0u;
+		qreal							bestScalar = 0.;
+		bool							incremental = false;
+		
+		inline void						attach(std::shared_ptr<const HexDataSnapshot>, quint32);
+		inline const HexDayHistory&				day(quint32) const;
+		inline quint32						numberOfDays(void) const;
+};
+
+void HexSearchBuffer::attach(std::shared_ptr<const HexDataSnapshot> foo, quint32 sc)
+{
+	HexSearchBuffer::scope = sc;
+	HexSearchBuffer::partialQuery.clear();
+	HexSearchBuffer::partialHistory.clear();
+	
+	if (HexSearchBuffer::snapshot == foo)
+		return;
+	
+	HexSearchBuffer::snapshot = std::move(foo);
+	HexSearchBuffer::posiPrecedents.clear();
+	HexSearchBuffer::negaPrecedents.clear();
+	HexSearchBuffer::positivePrecedents.clear();
+	HexSearchBuffer::negativePrecedents.clear();
+}
+
+const HexDayHistory& HexSearchBuffer::day(quint32 index) const
+{
+	return (index < HexSearchBuffer::snapshot->days.size() ? *HexSearchBuffer::snapshot->days[index] : *HexSearchBuffer::today);
+}
+
+quint32 HexSearchBuffer::numberOfDays(void) const
+{
+	return static_cast<quint32>(HexSearchBuffer::snapshot->days.size()) + (HexSearchBuffer::today != nullptr ? 1u : 0u);
+}
+
+#endif
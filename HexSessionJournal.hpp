@@ -0,0 +1,203 @@
+#ifndef __SESSION_JOURNAL_HPP__
+#define __SESSION_JOURNAL_HPP__
+
+// Qt Libraries
+#include <QByteArray>
+#include <QFile>
+
+// Standard Libraries
+#include <iostream>
+
+// Personal Libraries
+#include "OtherClasses.hpp"
+
+class HexSessionJournal
+{
+	private:
+	
+		static constexpr quint32					Magic = 0x314A'5848u;
+		static constexpr quint32					MaxShift = 8u;
+		
+		template<typename Type>
+		inline static void						Append(QByteArray&, const Type&);
+		
+		QFile								file;
+		QByteArray							buffer;
+		std::vector<HexCandlestick<qreal>>				previous;
+		
+		template<typename Type>
+		inline bool							take(Type&);
+	
+	public:
+	
+		static constexpr quint8						FrameRecord = 0u;
+		static constexpr quint8						GapRecord = 1u;
+		
+		inline void							close(void);
+		inline bool							create(const QString&, quint32, quint32, quint32, qreal);
+		inline bool							isOpen(void) const;
+		inline bool							open(const QString&, quint32&, quint32&, quint32&, qreal&);
+		inline bool							read(HexJournalEntry&);
+		inline void							writeFrame(qint64, qint32, qreal, const std::vector<HexCandlestick<qreal>>&);
+		inline void							writeGap(qint64, qreal);
+};
+
+template<typename Type>
+void HexSessionJournal::Append(QByteArray& bytes, const Type& value)
+{
+	bytes.append(reinterpret_cast<const char*>(&value), sizeof(Type));
+}
+
+void HexSessionJournal::close(void)
+{
+	HexSessionJournal::file.close();
+	HexSessionJournal::previous.clear();
+}
+
+bool HexSessionJournal::create(const QString& path, quint32 timeUnit, quint32 numberOfCandlesticks, quint32 feedingTimeUnit, qreal gap)
+{
+	HexSessionJournal::close();
+	HexSessionJournal::file.setFileName(path);
+	
+	if (!HexSessionJournal::file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		std::cout << "Could not write file [" << path.toStdString() + "]." << std::endl;
+		return false;
+	}
+	
+	HexSessionJournal::buffer.clear();
+	HexSessionJournal::Append(HexSessionJournal::buffer, HexSessionJournal::Magic);
+	HexSessionJournal::Append(HexSessionJournal::buffer, timeUnit);
+	HexSessionJournal::Append(HexSessionJournal::buffer, numberOfCandlesticks);
+	HexSessionJournal::Append(HexSessionJournal::buffer, feedingTimeUnit);
+	HexSessionJournal::Append(HexSessionJournal::buffer, gap);
+	HexSessionJournal::file.write(HexSessionJournal::buffer);
+	return true;
+}
+
+bool HexSessionJournal::isOpen(void) const
+{
+	return HexSessionJournal::file.isOpen();
+}
+
+bool HexSessionJournal::open(const QString& path, quint32& timeUnit, quint32& numberOfCandlesticks, quint32& feedingTimeUnit, qreal& gap)
+{
+	HexSessionJournal::close();
+	HexSessionJournal::file.setFileName(path);
+	
+	if (!HexSessionJournal::file.open(QIODevice::ReadOnly))
+	{
+		std::cout << "Could not read file [" << path.toStdString() + "]." << std::endl;
+		return false;
+	}
+	
+	auto magic = 0u;
+	const auto valid = HexSessionJournal::take(magic) and magic == HexSessionJournal::Magic and HexSessionJournal::take(timeUnit)
+				and HexSessionJournal::take(numberOfCandlesticks) and HexSessionJournal::take(feedingTimeUnit) and HexSessionJournal::take(gap);
+	
+	if (!valid)
+	{
+		std::cout << "File [" << path.toStdString() + "] is not a session journal." << std::endl;
+		HexSessionJournal::close();
+	}
+	
+	return valid;
+}
+
+bool HexSessionJournal::read(HexJournalEntry& entry)
+{
+	if (not HexSessionJournal::take(entry.type) or not HexSessionJournal::take(entry.timestamp))
+		return false;
+	
+	if (entry.type == HexSessionJournal::GapRecord)
+		return HexSessionJournal::take(entry.gap);
+	
+	auto shift = 0u;
+	auto kept = 0u;
+	auto appended = 0u;
+	
+	if (not HexSessionJournal::take(entry.secsFromRef) or not HexSessionJournal::take(entry.gap) or not HexSessionJournal::take(shift) or not HexSessionJournal::take(kept) or not HexSessionJournal::take(appended))
+		return false;
+	
+	if (shift + kept > HexSessionJournal::previous.size())
+		return false;
+	
+	entry.candlesticks.assign(HexSessionJournal::previous.cbegin() + shift, HexSessionJournal::previous.cbegin() + shift + kept);
+	
+	for (auto i = 0u; i < appended; ++i)
+	{
+		HexCandlestick<qreal> candlestick;
+		
+		if (not HexSessionJournal::take(candlestick.low) or not HexSessionJournal::take(candlestick.high))
+			return false;
+		
+		entry.candlesticks.push_back(candlestick);
+	}
+	
+	HexSessionJournal::previous = entry.candlesticks;
+	return true;
+}
+
+template<typename Type>
+bool HexSessionJournal::take(Type& value)
+{
+	return (HexSessionJournal::file.read(reinterpret_cast<char*>(&value), sizeof(Type)) == static_cast<qint64>(sizeof(Type)));
+}
+
+void HexSessionJournal::writeFrame(qint64 timestamp, qint32 secsFromRef, qreal gap, const std::vector<HexCandlestick<qreal>>& candlesticks)
+{
+	if (!HexSessionJournal::file.isOpen())
+		return;
+	
+	const auto& previous = HexSessionJournal::previous;
+	auto shift = 0u;
+	auto kept = 0u;
+	
+	for (auto s = 0u; s <= HexSessionJournal::MaxShift and s <= previous.size(); ++s)
+	{
+		auto common = 0u;
+		
+		while (s + common < previous.size() and common < candlesticks.size() and previous[s + common].low == candlesticks[common].low and previous[s + common].high == candlesticks[common].high)
+			++common;
+		
+		if (common > kept)
+		{
+			shift = s;
+			kept = common;
+		}
+	}
+	
+	const auto appended = static_cast<quint32>(candlesticks.size()) - kept;
+	
+	HexSessionJournal::buffer.clear();
+	HexSessionJournal::Append(HexSessionJournal::buffer, HexSessionJournal::FrameRecord);
+	HexSessionJournal::Append(HexSessionJournal::buffer, timestamp);
+	HexSessionJournal::Append(HexSessionJournal::buffer, secsFromRef);
+	HexSessionJournal::Append(HexSessionJournal::buffer, gap);
+	HexSessionJournal::Append(HexSessionJournal::buffer, shift);
+	HexSessionJournal::Append(HexSessionJournal::buffer, kept);
+	HexSessionJournal::Append(HexSessionJournal::buffer, appended);
+	
+	for (auto it = candlesticks.cbegin() + kept; it != candlesticks.cend(); ++it)
+	{
+		HexSessionJournal::Append(HexSessionJournal::buffer, it->low);
+		HexSessionJournal::Append(HexSessionJournal::buffer, it->high);
+	}
+	
+	HexSessionJournal::file.write(HexSessionJournal::buffer);
+	HexSessionJournal::previous = candlesticks;
+}
+
+void HexSessionJournal::writeGap(qint64 timestamp, qreal gap)
+{
+	if (!HexSessionJournal::file.isOpen())
+		return;
+	
+	HexSessionJournal::buffer.clear();
+	HexSessionJournal::Append(HexSessionJournal::buffer, HexSessionJournal::GapRecord);
+	HexSessionJournal::Append(HexSessionJournal::buffer, timestamp);
+	HexSessionJournal::Append(HexSessionJournal::buffer, gap);
+	HexSessionJournal::file.write(HexSessionJournal::buffer);
+}
+
+#endif
@@ -0,0 +1,363 @@
+#ifndef __SNAPSHOT_STORE_HPP__
+#define __SNAPSHOT_STORE_HPP__
+
+// Qt Libraries
+#include <QByteArray>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QThread>
+
+// Standard Libraries
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <mutex>
+
+// Personal Libraries
+#include "HexDataSnapshot.hpp"
+
+class HexSnapshotStore
+{
+	private:
+	
+		static constexpr quint32					Magic = 0x3153'5848u;
+		static constexpr quint32					Version = 2u;
+		static constexpr quint64					Offset = 14'695'981'039'346'656'037u;
+		static constexpr quint64					Prime = 1'099'511'628'211u;
+		static const QString						DirectoryPath;
+		
+		template<typename Type>
+		inline static void						Append(QByteArray&, const Type&);
+		inline static void						AppendText(QByteArray&, const QString&);
+		inline static quint64						Checksum(const uchar*, quint64);
+		inline static QString						FilePath(const QString&, quint32, quint32, quint32, qreal);
+		inline static std::shared_ptr<const HexDayHistory>		ReadDay(const uchar*&, const uchar*, quint32, quint32, qreal, QString&, HexFileStamp&);
+		template<typename Type>
+		inline static bool						Take(const uchar*&, const uchar*, Type&);
+		inline static bool						TakeText(const uchar*&, const uchar*, QString&);
+		inline static bool						Write(const HexDataSnapshot&);
+		
+		std::deque<std::shared_ptr<const HexDataSnapshot>>		pending;
+		std::mutex							queue;
+		QThread*							writer = nullptr;
+		bool								writing = false;
+		
+		inline void							run(void);
+	
+	public:
+	
+		inline								~HexSnapshotStore(void);
+		inline std::shared_ptr<const HexDataSnapshot>			load(const QString&, quint32, quint32, quint32, qreal) const;
+		inline void							save(std::shared_ptr<const HexDataSnapshot>);
+};
+
+HexSnapshotStore::~HexSnapshotStore(void)
+{
+	if (HexSnapshotStore::writer != nullptr)
+	{
+		HexSnapshotStore::writer->wait();
+		delete HexSnapshotStore::writer;
+	}
+}
+
+template<typename Type>
+void HexSnapshotStore::Append(QByteArray& bytes, const Type& value)
+{
+	bytes.append(reinterpret_cast<const char*>(&value), sizeof(Type));
+}
+
+void HexSnapshotStore::AppendText(QByteArray& bytes, const QString& text)
+{
+	const auto latin = text.toLatin1();
+	HexSnapshotStore::Append(bytes, static_cast<quint32>(latin.size()));
+	bytes.append(latin.constData(), latin.size());
+}
+
+quint64 HexSnapshotStore::Checksum(const uchar* data, quint64 size)
+{
+	auto hash = HexSnapshotStore::Offset;
+	auto i = static_cast<quint64>(0u);
+	
+	for (; i + sizeof(quint64) <= size; i += sizeof(quint64))
+	{
+		quint64 word;
+		std::memcpy(&word, data + i, sizeof(quint64));
+		hash = (hash ^ word)*HexSnapshotStore::Prime;
+		hash ^= hash >> 32u;
+	}
+	
+	for (; i < size; ++i)
+		hash = (hash ^ data[i])*HexSnapshotStore::Prime;
+	
+	return hash;
+}
+
+QString HexSnapshotStore::FilePath(const QString& directory, quint32 numberOfDays, quint32 timeUnit, quint32 numberOfCandlesticks, qreal firstCoefficient)
+{
+	return HexSnapshotStore::DirectoryPath + directory + '_' + QString::number(numberOfDays) + '_' + QString::number(timeUnit) + 'x' + QString::number(numberOfCandlesticks) + '_' + QString::number(firstCoefficient*100.) + ".bin";
+}
+
+std::shared_ptr<const HexDataSnapshot> HexSnapshotStore::load(const QString& directory, quint32 numberOfDays, quint32 timeUnit, quint32 numberOfCandlesticks, qreal firstCoefficient) const
+{
+	const auto path = HexSnapshotStore::FilePath(directory, numberOfDays, timeUnit, numberOfCandlesticks, firstCoefficient);
+	QFile snapshotFile(path);
+	
+	if (!snapshotFile.open(QIODevice::ReadOnly))
+		return nullptr;
+	
+	QElapsedTimer timer;
+	timer.start();
+	
+	const auto size = snapshotFile.size();
+	const auto first = snapshotFile.map(0, size);
+	
+	if (first == nullptr)
+	{
+		std::cout << "Could not read file [" << path.toStdString() + "]." << std::endl;
+		return nullptr;
+	}
+	
+	const auto last = first + size;
+	auto cursor = static_cast<const uchar*>(first);
+	auto magic = 0u;
+	auto version = 0u;
+	auto tu = 0u;
+	auto nc = 0u;
+	auto nb = 0u;
+	auto fc = 0.;
+	
+	auto valid = HexSnapshotStore::Take(cursor, last, magic) and magic == HexSnapshotStore::Magic and HexSnapshotStore::Take(cursor, last, version) and version == HexSnapshotStore::Version
+			and HexSnapshotStore::Take(cursor, last, tu) and HexSnapshotStore::Take(cursor, last, nc) and HexSnapshotStore::Take(cursor, last, fc)
+			and HexSnapshotStore::Take(cursor, last, nb) and nb == numberOfDays and tu == timeUnit and nc == numberOfCandlesticks and fc == firstCoefficient;
+	
+	auto snapshot = std::make_shared<HexDataSnapshot>();
+	
+	for (auto i = 0u; valid and i < numberOfDays; ++i)
+	{
+		QString file;
+		HexFileStamp stamp;
+		auto day = HexSnapshotStore::ReadDay(cursor, last, timeUnit, numberOfCandlesticks, firstCoefficient, file, stamp);
+		
+		if (day == nullptr)
+			valid = false;
+		else
+		{
+			snapshot->days.push_back(std::move(day));
+			snapshot->files.push_back(file);
+			snapshot->stamps.push_back(stamp);
+		}
+	}
+	
+	snapshotFile.unmap(first);
+	
+	if (not valid or cursor != last)
+	{
+		std::cout << "File [" << path.toStdString() + "] is not a valid snapshot." << std::endl;
+		return nullptr;
+	}
+	
+	snapshot->directory = directory;
+	snapshot->timeUnit = timeUnit;
+	snapshot->numberOfCandlesticks = numberOfCandlesticks;
+	snapshot->firstCoefficient = firstCoefficient;
+	
+	std::cout << " >> " << numberOfDays << " days restored from [" << path.toStdString() << "] in " << timer.elapsed() << " ms." << std::endl;
+	return snapshot;
+}
+
+std::shared_ptr<const HexDayHistory> HexSnapshotStore::ReadDay(const uchar*& cursor, const uchar* last, quint32 timeUnit, quint32 numberOfCandlesticks, qreal firstCoefficient, QString& file, HexFileStamp& stamp)
+{
+	auto size = static_cast<quint64>(0u);
+	auto checksum = static_cast<quint64>(0u);
+	
+	if (not HexSnapshotStore::Take(cursor, last, size) or not HexSnapshotStore::Take(cursor, last, checksum) or static_cast<quint64>(last - cursor) < size)
+		return nullptr;
+	
+	if (HexSnapshotStore::Checksum(cursor, size) != checksum)
+		return nullptr;
+	
+	const auto end = cursor + size;
+	const auto windowSize = numberOfCandlesticks*sizeof(HexCandlestick<qreal>);
+	const auto numberOfElementaryCandlesticks = timeUnit*numberOfCandlesticks;
+	QString date;
+	auto numberOfRecords = 0u;
+	auto numberOfWindows = 0u;
+	
+	if (not HexSnapshotStore::TakeText(cursor, end, file) or not HexSnapshotStore::Take(cursor, end, stamp.size) or not HexSnapshotStore::Take(cursor, end, stamp.modified))
+		return nullptr;
+	
+	if (not HexSnapshotStore::TakeText(cursor, end, date) or not HexSnapshotStore::Take(cursor, end, numberOfRecords))
+		return nullptr;
+	
+	if (static_cast<quint64>(end - cursor) < static_cast<quint64>(numberOfRecords)*sizeof(HexCandlestick<qreal>))
+		return nullptr;
+	
+	auto record = std::make_shared<std::vector<HexCandlestick<qreal>>>(numberOfRecords);
+	std::memcpy(record->data(), cursor, numberOfRecords*sizeof(HexCandlestick<qreal>));
+	cursor += numberOfRecords*sizeof(HexCandlestick<qreal>);
+	
+	if (not HexSnapshotStore::Take(cursor, end, numberOfWindows) or numberOfWindows != (numberOfRecords > numberOfElementaryCandlesticks ? numberOfRecords - numberOfElementaryCandlesticks : 0u))
+		return nullptr;
+	
+	if (static_cast<quint64>(end - cursor) != static_cast<quint64>(numberOfWindows)*(4u*sizeof(qreal) + windowSize))
+		return nullptr;
+	
+	std::vector<HexNormalisedInfo> windows;
+	windows.reserve(numberOfWindows);
+	
+	for (auto i = 0u; i < numberOfWindows; ++i)
+	{
+		auto lastHigh = 0.;
+		auto lastLow = 0.;
+		auto mean = 0.;
+		auto norm = 0.;
+		
+		HexSnapshotStore::Take(cursor, end, lastHigh);
+		HexSnapshotStore::Take(cursor, end, lastLow);
+		HexSnapshotStore::Take(cursor, end, mean);
+		HexSnapshotStore::Take(cursor, end, norm);
+		
+		std::vector<HexCandlestick<qreal>> candlesticks(numberOfCandlesticks);
+		std::memcpy(candlesticks.data(), cursor, windowSize);
+		cursor += windowSize;
+		
+		windows.emplace_back(lastHigh, lastLow, mean, norm, std::move(candlesticks));
+	}
+	
+	return std::make_shared<HexDayHistory>(date, std::move(record), std::move(windows), timeUnit, numberOfCandlesticks, firstCoefficient);
+}
+
+void HexSnapshotStore::run(void)
+{
+	std::unique_lock<std::mutex> lock(HexSnapshotStore::queue);
+	
+	while (not HexSnapshotStore::pending.empty())
+	{
+		const auto snapshot = std::move(HexSnapshotStore::pending.front());
+		HexSnapshotStore::pending.pop_front();
+		
+		lock.unlock();
+		HexSnapshotStore::Write(*snapshot);
+		lock.lock();
+	}
+	
+	HexSnapshotStore::writing = false;
+}
+
+void HexSnapshotStore::save(std::shared_ptr<const HexDataSnapshot> snapshot)
+{
+	std::lock_guard<std::mutex> lock(HexSnapshotStore::queue);
+	HexSnapshotStore::pending.push_back(std::move(snapshot));
+	
+	if (HexSnapshotStore::writing)
+		return;
+	
+	if (HexSnapshotStore::writer != nullptr)
+	{
+		HexSnapshotStore::writer->wait();
+		delete HexSnapshotStore::writer;
+	}
+	
+	HexSnapshotStore::writing = true;
+	HexSnapshotStore::writer = QThread::create([this](){ HexSnapshotStore::run(); });
+	HexSnapshotStore::writer->start(QThread::LowPriority);
+}
+
+template<typename Type>
+bool HexSnapshotStore::Take(const uchar*& cursor, const uchar* last, Type& value)
+{
+	if (static_cast<quint64>(last - cursor) < sizeof(Type))
+		return false;
+	
+	std::memcpy(&value, cursor, sizeof(Type));
+	cursor += sizeof(Type);
+	return true;
+}
+
+bool HexSnapshotStore::TakeText(const uchar*& cursor, const uchar* last, QString& text)
+{
+	auto size = 0u;
+	
+	if (not HexSnapshotStore::Take(cursor, last, size) or static_cast<quint64>(last - cursor) < size)
+		return false;
+	
+	text = QString::fromLatin1(reinterpret_cast<const char*>(cursor), size);
+	cursor += size;
+	return true;
+}
+
+bool HexSnapshotStore::Write(const HexDataSnapshot& snapshot)
+{
+	const auto path = HexSnapshotStore::FilePath(snapshot.directory, static_cast<quint32>(snapshot.days.size()), snapshot.timeUnit, snapshot.numberOfCandlesticks, snapshot.firstCoefficient);
+	QDir().mkpath(HexSnapshotStore::DirectoryPath);
+	QFile snapshotFile(path + ".tmp");
+	
+	if (!snapshotFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		std::cout << "Could not write file [" << path.toStdString() + ".tmp]." << std::endl;
+		return false;
+	}
+	
+	QByteArray buffer;
+	HexSnapshotStore::Append(buffer, HexSnapshotStore::Magic);
+	HexSnapshotStore::Append(buffer, HexSnapshotStore::Version);
+	HexSnapshotStore::Append(buffer, snapshot.timeUnit);
+	HexSnapshotStore::Append(buffer, snapshot.numberOfCandlesticks);
+	HexSnapshotStore::Append(buffer, snapshot.firstCoefficient);
+	HexSnapshotStore::Append(buffer, static_cast<quint32>(snapshot.days.size()));
+	auto written = (snapshotFile.write(buffer) == buffer.size());
+	
+	for (auto i = 0u; written and i < snapshot.days.size(); ++i)
+	{
+		const auto& day = *snapshot.days[i];
+		const auto& candlesticks = day.candlesticks();
+		
+		buffer.clear();
+		HexSnapshotStore::AppendText(buffer, snapshot.files[i]);
+		HexSnapshotStore::Append(buffer, snapshot.stamps[i].size);
+		HexSnapshotStore::Append(buffer, snapshot.stamps[i].modified);
+		HexSnapshotStore::AppendText(buffer, day.dateString());
+		HexSnapshotStore::Append(buffer, static_cast<quint32>(candlesticks.size()));
+		buffer.append(reinterpret_cast<const char*>(candlesticks.data()), candlesticks.size()*sizeof(HexCandlestick<qreal>));
+		HexSnapshotStore::Append(buffer, static_cast<quint32>(day.windows().size()));
+		
+		for (const auto& window : day.windows())
+		{
+			HexSnapshotStore::Append(buffer, window.lastHigh);
+			HexSnapshotStore::Append(buffer, window.lastLow);
+			HexSnapshotStore::Append(buffer, window.mean);
+			HexSnapshotStore::Append(buffer, window.norm);
+			buffer.append(reinterpret_cast<const char*>(window.normalisedCandlesticks.data()), window.normalisedCandlesticks.size()*sizeof(HexCandlestick<qreal>));
+		}
+		
+		const auto size = static_cast<quint64>(buffer.size());
+		const auto checksum = HexSnapshotStore::Checksum(reinterpret_cast<const uchar*>(buffer.constData()), size);
+		
+		written = (snapshotFile.write(reinterpret_cast<const char*>(&size), sizeof(quint64)) == sizeof(quint64))
+				and (snapshotFile.write(reinterpret_cast<const char*>(&checksum), sizeof(quint64)) == sizeof(quint64))
+				and (snapshotFile.write(buffer) == buffer.size());
+	}
+	
+	snapshotFile.close();
+	
+	if (not written)
+	{
+		std::cout << "Could not write file [" << path.toStdString() + ".tmp]." << std::endl;
+		snapshotFile.remove();
+		return false;
+	}
+	
+	QFile::remove(path);
+	
+	if (not snapshotFile.rename(path))
+	{
+		std::cout << "Could not write file [" << path.toStdString() + "]." << std::endl;
+		return false;
+	}
+	
+	std::cout << " >> Snapshot " << snapshot.version << " saved into [" << path.toStdString() << "]." << std::endl;
+	return true;
+}
+
+#endif
@@ -0,0 +1,189 @@
+#ifndef __WORKER_POOL_HPP__
+#define __WORKER_POOL_HPP__
+
+// Qt Libraries
+#include <QElapsedTimer>
+#include <QThread>
+
+// Standard Libraries
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <utility>
+
+// Personal Libraries
+#include "OtherClasses.hpp"
+
+class HexWorkerPool
+{
+	private:
+	
+		static constexpr qint64							LiveLatencyTarget = 2'000'000;
+		static constexpr std::array<QThread::Priority, 3u>			Priorities = { QThread::TimeCriticalPriority, QThread::HighPriority, QThread::LowPriority };
+		
+		std::array<std::deque<HexPoolTask>, 3u>					queues;
+		std::vector<QThread*>							workers;
+		std::mutex								mutex;
+		std::condition_variable							condition;
+		QElapsedTimer								clock;
+		quint32									numberOfRunningBatches = 0u;
+		quint32									numberOfRunningInteractives = 0u;
+		quint32									sharedLimit;
+		quint64									numberOfLateTasks = 0u;
+		bool									stopping = false;
+		
+		inline qint32								pick(void) const;
+		inline void								work(void);
+	
+	public:
+	
+		inline									HexWorkerPool(void);
+		inline									~HexWorkerPool(void);
+		inline std::future<void>						launch(QoSEnum, std::function<void(void)>);
+		inline void								run(QoSEnum, const std::function<void(void)>&);
+		inline void								run(QoSEnum, const std::vector<std::function<void(void)>>&);
+		inline void								submit(QoSEnum, std::function<void(void)>);
+		inline quint64								takeLateTasks(void);
+};
+
+HexWorkerPool::HexWorkerPool(void)
+{
+	const auto numberOfWorkers = static_cast<quint32>(std::max(QThread::idealThreadCount(), 2));
+	HexWorkerPool::sharedLimit = numberOfWorkers - 1u;
+	HexWorkerPool::clock.start();
+	
+	for (auto i = 0u; i < numberOfWorkers; ++i)
+	{
+		HexWorkerPool::workers.push_back(QThread::create([this](){ HexWorkerPool::work(); }));
+		HexWorkerPool::workers.back()->start();
+	}
+}
+
+HexWorkerPool::~HexWorkerPool(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(HexWorkerPool::mutex);
+		HexWorkerPool::stopping = true;
+	}
+	
+	HexWorkerPool::condition.notify_all();
+	
+	for (const auto worker : HexWorkerPool::workers)
+	{
+		worker->wait();
+		delete worker;
+	}
+}
+
+std::future<void> HexWorkerPool::launch(QoSEnum qos, std::function<void(void)> function)
+{
+	const auto done = std::make_shared<std::promise<void>>();
+	auto future = done->get_future();
+	
+	HexWorkerPool::submit(qos, [function = std::move(function), done](){ function(); done->set_value(); });
+	return future;
+}
+
+qint32 HexWorkerPool::pick(void) const
+{
+	if (not HexWorkerPool::queues[static_cast<quint32>(QoSEnum::Live)].empty())
+		return static_cast<qint32>(QoSEnum::Live);
+	
+	// Interactive and batch tasks together never take the last worker, which stays free for live searches.
+	if (HexWorkerPool::numberOfRunningBatches + HexWorkerPool::numberOfRunningInteractives >= HexWorkerPool::sharedLimit)
+		return -1;
+	
+	if (not HexWorkerPool::queues[static_cast<quint32>(QoSEnum::Interactive)].empty())
+		return static_cast<qint32>(QoSEnum::Interactive);
+	
+	if (not HexWorkerPool::queues[static_cast<quint32>(QoSEnum::Batch)].empty())
+		return static_cast<qint32>(QoSEnum::Batch);
+	
+	return -1;
+}
+
+void HexWorkerPool::run(QoSEnum qos, const std::function<void(void)>& function)
+{
+	const auto done = std::make_shared<std::promise<void>>();
+	auto future = done->get_future();
+	
+	HexWorkerPool::submit(qos, [&function, done](){ function(); done->set_value(); });
+	future.wait();
+}
+
+void HexWorkerPool::run(QoSEnum qos, const std::vector<std::function<void(void)>>& functions)
+{
+	std::vector<std::future<void>> futures;
+	futures.reserve(functions.size());
+	
+	for (const auto& function : functions)
+	{
+		const auto done = std::make_shared<std::promise<void>>();
+		futures.push_back(done->get_future());
+		HexWorkerPool::submit(qos, [&function, done](){ function(); done->set_value(); });
+	}
+	
+	for (auto& future : futures)
+		future.wait();
+}
+
+void HexWorkerPool::submit(QoSEnum qos, std::function<void(void)> function)
+{
+	{
+		std::lock_guard<std::mutex> lock(HexWorkerPool::mutex);
+		HexWorkerPool::queues[static_cast<quint32>(qos)].push_back({ std::move(function), HexWorkerPool::clock.nsecsElapsed() });
+	}
+	
+	HexWorkerPool::condition.notify_one();
+}
+
+quint64 HexWorkerPool::takeLateTasks(void)
+{
+	std::lock_guard<std::mutex> lock(HexWorkerPool::mutex);
+	return std::exchange(HexWorkerPool::numberOfLateTasks, 0u);
+}
+
+void HexWorkerPool::work(void)
+{
+	std::unique_lock<std::mutex> lock(HexWorkerPool::mutex);
+	
+	while (true)
+	{
+		HexWorkerPool::condition.wait(lock, [this](){ return HexWorkerPool::stopping or HexWorkerPool::pick() >= 0; });
+		const auto index = HexWorkerPool::pick();
+		
+		if (index < 0)
+			return;
+		
+		auto& queue = HexWorkerPool::queues[static_cast<quint32>(index)];
+		auto task = std::move(queue.front());
+		queue.pop_front();
+		
+		const auto batch = (index == static_cast<qint32>(QoSEnum::Batch));
+		const auto interactive = (index == static_cast<qint32>(QoSEnum::Interactive));
+		
+		if (batch)
+			++HexWorkerPool::numberOfRunningBatches;
+		else if (interactive)
+			++HexWorkerPool::numberOfRunningInteractives;
+		else if (HexWorkerPool::clock.nsecsElapsed() - task.enqueued > HexWorkerPool::LiveLatencyTarget)
+			++HexWorkerPool::numberOfLateTasks;
+		
+		lock.unlock();
+		QThread::currentThread()->setPriority(HexWorkerPool::Priorities[static_cast<quint32>(index)]);
+		task.function();
+		lock.lock();
+		
+		if (batch)
+			--HexWorkerPool::numberOfRunningBatches;
+		else if (interactive)
+			--HexWorkerPool::numberOfRunningInteractives;
+		
+		if (batch or interactive)
+			HexWorkerPool::condition.notify_one();
+	}
+}
+
+#endif
@@ -4,6 +4,10 @@
 // Personal Libraries
 #include "QScalarWindow.hpp"
 
+const quint64 HexDataCenter::MemoryCap = 8'589'934'592u;
+const QString HexKernelTuner::FileName = "kernels.txt";
+const QString HexSnapshotStore::DirectoryPath = "snapshots/";
+const QString QTerminalModel::SpillPath = "terminal.bin";
 const std::vector<qreal> QFeedingThread::Gaps = { 0.25, 0.5, 1., 5., 10., 50., 100., 500. };
 std::vector<qreal> HexNormalisedInfo::Coefficients = { };
 
@@ -2,13 +2,27 @@
 #define __OTHER_CLASSES_HPP__
 
 // Standard Libraries
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
+#include <cstring>
+#include <functional>
+#include <memory>
 #include <vector>
 
 //Qt Libraries
+#include <QImage>
 #include <QString>
+#include <QStringList>
 
+enum class KernelEnum { Generic, Specialised, Paired };
 enum class MissionEnum { Analyse, Feed, Locate, Scan };
+enum class QoSEnum { Live, Interactive, Batch };
+enum class SourceEnum { Screen, File, Socket, Replay };
+enum class StageEnum { Capture, Parse, Search, Publish, Total };
+
+class HexDataSnapshot;
 
 template<typename Type>
 class HexCandlestick
@@ -23,6 +37,42 @@ class HexCandlestick
 		}
 };
 
+class HexCandleFrame
+{
+	public:
+	
+		std::vector<HexCandlestick<qreal>>	candlesticks;
+		qreal					gap = 1.;
+		qint32					secsFromRef = 0;
+		qint64					timestamp = 0;
+		quint32					sessionSize = 0u;
+		quint32					session = 0u;
+};
+
+class HexCancelToken
+{
+	private:
+	
+		std::atomic<bool>	cancelled = false;
+	
+	public:
+	
+		inline void cancel(void)
+		{
+			HexCancelToken::cancelled.store(true, std::memory_order_relaxed);
+		}
+		
+		inline bool isCancelled(void) const
+		{
+			return HexCancelToken::cancelled.load(std::memory_order_relaxed);
+		}
+		
+		inline void reset(void)
+		{
+			HexCancelToken::cancelled.store(false, std::memory_order_relaxed);
+		}
+};
+
 class HexCheckFile
 {
 	public:
@@ -44,7 +94,34 @@ class HexCheckFile
 		qreal		stopLoss;
 		
 		quint32		feedingTimeUnit = 1u;
+		quint32		latencyBudget = 0u;
+		SourceEnum	source = SourceEnum::Screen;
+		QString		replayPath;
+		quint32		replaySpeed = 0u;
+		QStringList	companions;
 		bool		abort = true;
+		
+		inline bool sharesData(const HexCheckFile& other) const
+		{
+			return (HexCheckFile::directory == other.directory and HexCheckFile::numberOfDays == other.numberOfDays and HexCheckFile::timeUnit == other.timeUnit
+					and HexCheckFile::numberOfCandlesticks == other.numberOfCandlesticks and HexCheckFile::firstCoefficient == other.firstCoefficient);
+		}
+};
+
+class HexFileStamp
+{
+	public:
+	
+		qint64	size = -1;
+		qint64	modified = 0;
+		
+		HexFileStamp(void) = default;
+		
+		HexFileStamp(qint64 s, qint64 m) : size(s), modified(m)
+		{
+		}
+		
+		bool operator==(const HexFileStamp&) const = default;
 };
 
 class HexFullFile
@@ -113,7 +190,7 @@ class HexFullReport
 		qint32 bWin = 0;
 		qint32 eWin = 0;
 		qint32 sWin = 0;
-	
+		
 		qreal bSuccessRate = 0.;
 		qreal bAverageGain = 0.;
 		
@@ -127,39 +204,58 @@ class HexFullReport
 		qreal sExpandedAverageGain = 0.;
 };
 
-class HexNormalisedInfo
+class HexImageFrame
 {
-	private:
-		
-		static std::vector<qreal>			Coefficients;
+	public:
 	
+		QImage		image;
+		qint32		secsFromRef = 0;
+		qint64		timestamp = 0;
+		qint64		interval = 0;
+		qint32		left = 0;
+		bool		full = true;
+};
+
+class HexJournalEntry
+{
 	public:
-		
-		qreal					lastHigh;
-		qreal					lastLow;
-		qreal					norm;
-		std::vector<HexCandlestick<qreal>>	normalisedCandlesticks;
-		
-		inline static void UpdateCoefficients(qreal firstCoefficient, quint32 numberOfCandlesticks)
-		{
-			HexNormalisedInfo::Coefficients.clear();
-			HexNormalisedInfo::Coefficients.reserve(numberOfCandlesticks);
-			
-			const auto increment = (1. - firstCoefficient)/static_cast<qreal>(numberOfCandlesticks - 1u);
-			
-			for (auto i = 0u; i < numberOfCandlesticks; ++i)
-				HexNormalisedInfo::Coefficients.push_back(firstCoefficient + static_cast<qreal>(i)*increment);
-		}
+	
+		std::vector<HexCandlestick<qreal>>	candlesticks;
+		qreal					gap = 1.;
+		qint64					timestamp = 0;
+		qint32					secsFromRef = 0;
+		quint8					type = 0u;
+};
+
+class HexPartialInfo
+{
+	public:
+	
+		qreal straight = 0.;
+		qreal reversed = 0.;
+		qreal sum = 0.;
+};
+
+template<quint32 Size, bool Pairing = false, bool Increment = false>
+class HexKernel
+{
+	public:
+	
+		static constexpr quint32 Length = Size;
+		static constexpr bool Paired = Pairing;
+		static constexpr bool Incremental = Increment;
 		
 		template<typename Type>
-		HexNormalisedInfo(Type it, quint32 timeUnit, quint32 numberOfCandlesticks)
+		inline static std::vector<HexCandlestick<qreal>> ExtractCandlesticks(Type it, quint32 timeUnit, quint32 numberOfCandlesticks)
 		{
-			HexNormalisedInfo::normalisedCandlesticks.reserve(numberOfCandlesticks);
-			auto mean = 0.;
+			const auto count = (Size != 0u ? Size : numberOfCandlesticks);
+			std::vector<HexCandlestick<qreal>> candlesticks(count);
 			
-			for (auto i = 0u; i < numberOfCandlesticks; ++i)
+			for (auto i = 0u; i < count; ++i)
 			{
-				auto& cs = HexNormalisedInfo::normalisedCandlesticks.emplace_back(it->low, it->high);
+				auto& cs = candlesticks[i];
+				cs.low = it->low;
+				cs.high = it->high;
 				++it;
 				
 				for (auto j = 1u; j < timeUnit; ++j)
@@ -172,70 +268,321 @@ class HexNormalisedInfo
 					
 					++it;
 				}
-				
-				mean += cs.low + cs.high;
 			}
 			
-			HexNormalisedInfo::lastLow = HexNormalisedInfo::normalisedCandlesticks.back().low;
-			HexNormalisedInfo::lastHigh = HexNormalisedInfo::normalisedCandlesticks.back().high;
+			return candlesticks;
+		}
+		
+		inline static qreal Scalar(const HexCandlestick<qreal>* first, const HexCandlestick<qreal>* second, const qreal* coefficients, quint32 numberOfCandlesticks)
+		{
+			const auto count = (Size != 0u ? Size : numberOfCandlesticks);
+			auto foo = 0.;
 			
-			mean /= static_cast<qreal>(numberOfCandlesticks*2.);
+			if (coefficients[0u] != 1.)
+			{
+				for (auto i = 0u; i < count; ++i)
+					foo += (first[i].low*second[i].low + first[i].high*second[i].high)*coefficients[i];
+			}
+			else
+			{
+				for (auto i = 0u; i < count; ++i)
+					foo += (first[i].low*second[i].low + first[i].high*second[i].high);
+			}
 			
-			auto itc = HexNormalisedInfo::Coefficients.cbegin();
-			auto scalar = 0.;
+			return foo;
+		}
+		
+		inline static std::pair<qreal, qreal> ScalarPair(const HexCandlestick<qreal>* first, const HexCandlestick<qreal>* second, const qreal* coefficients, quint32 numberOfCandlesticks)
+		{
+			const auto count = (Size != 0u ? Size : numberOfCandlesticks);
+			auto straight = 0.;
+			auto reversed = 0.;
 			
-			for (auto& cs : HexNormalisedInfo::normalisedCandlesticks)
+			if (coefficients[0u] != 1.)
 			{
-				cs.low -= mean;
-				cs.high -= mean;
-				
-				scalar += (cs.low*cs.low + cs.high*cs.high)*(*itc);
-				++itc;
+				for (auto i = 0u; i < count; ++i)
+				{
+					straight += (first[i].low*second[i].low + first[i].high*second[i].high)*coefficients[i];
+					reversed += ((-first[i].high)*second[i].low + (-first[i].low)*second[i].high)*coefficients[i];
+				}
+			}
+			else
+			{
+				for (auto i = 0u; i < count; ++i)
+				{
+					straight += (first[i].low*second[i].low + first[i].high*second[i].high);
+					reversed += ((-first[i].high)*second[i].low + (-first[i].low)*second[i].high);
+				}
 			}
 			
-			HexNormalisedInfo::norm = sqrtl(scalar);
+			return { straight, reversed };
+		}
+		
+		inline static HexPartialInfo Partials(const HexCandlestick<qreal>* query, const HexCandlestick<qreal>* window, const qreal* coefficients, quint32 numberOfCandlesticks)
+		{
+			const auto count = (Size != 0u ? Size : numberOfCandlesticks);
+			HexPartialInfo partial;
 			
-			for (auto& cs : HexNormalisedInfo::normalisedCandlesticks)
+			for (auto i = 0u; i < count; ++i)
+			{
+				partial.straight += (query[i].low*window[i].low + query[i].high*window[i].high)*coefficients[i];
+				partial.reversed += (query[i].high*window[i].low + query[i].low*window[i].high)*coefficients[i];
+				partial.sum += (window[i].low + window[i].high)*coefficients[i];
+			}
+			
+			return partial;
+		}
+};
+
+class HexKernelChoice
+{
+	public:
+	
+		KernelEnum	strategy = KernelEnum::Specialised;
+		qreal		throughput = 0.;
+};
+
+class HexKernelSwitch
+{
+	private:
+	
+		template<bool Paired, class Functor>
+		inline static auto Select(quint32 numberOfCandlesticks, Functor&& functor)
+		{
+			switch (numberOfCandlesticks)
+			{
+				case 5u:
+					return functor(HexKernel<5u, Paired>());
+				
+				case 8u:
+					return functor(HexKernel<8u, Paired>());
+				
+				case 10u:
+					return functor(HexKernel<10u, Paired>());
+				
+				case 12u:
+					return functor(HexKernel<12u, Paired>());
+				
+				case 15u:
+					return functor(HexKernel<15u, Paired>());
+				
+				case 20u:
+					return functor(HexKernel<20u, Paired>());
+				
+				case 30u:
+					return functor(HexKernel<30u, Paired>());
+				
+				case 60u:
+					return functor(HexKernel<60u, Paired>());
+				
+				default:
+					return functor(HexKernel<0u, Paired>());
+			}
+		}
+	
+	public:
+	
+		static constexpr std::array<quint32, 8u> SpecialisedLengths = { 5u, 8u, 10u, 12u, 15u, 20u, 30u, 60u };
+		
+		template<class Functor>
+		inline static auto Dispatch(quint32 numberOfCandlesticks, Functor&& functor)
+		{
+			return HexKernelSwitch::Select<false>(numberOfCandlesticks, functor);
+		}
+		
+		template<class Functor>
+		inline static auto Dispatch(quint32 numberOfCandlesticks, KernelEnum strategy, Functor&& functor)
+		{
+			switch (strategy)
+			{
+				case KernelEnum::Generic:
+					return functor(HexKernel<0u>());
+				
+				case KernelEnum::Paired:
+					return HexKernelSwitch::Select<true>(numberOfCandlesticks, functor);
+				
+				default:
+					return HexKernelSwitch::Select<false>(numberOfCandlesticks, functor);
+			}
+		}
+		
+		inline static bool IsSpecialised(quint32 numberOfCandlesticks)
+		{
+			return (std::find(HexKernelSwitch::SpecialisedLengths.cbegin(), HexKernelSwitch::SpecialisedLengths.cend(), numberOfCandlesticks) != HexKernelSwitch::SpecialisedLengths.cend());
+		}
+		
+		inline static QString Name(KernelEnum strategy)
+		{
+			switch (strategy)
 			{
-				cs.low /= HexNormalisedInfo::norm;
-				cs.high /= HexNormalisedInfo::norm;
+				case KernelEnum::Generic:
+					return "Generic";
+				
+				case KernelEnum::Specialised:
+					return "Specialised";
+				
+				case KernelEnum::Paired:
+					return "Paired";
 			}
+			
+			return QString();
+		}
+};
+
+class HexNormalisedInfo
+{
+	private:
+	
+		static std::vector<qreal>			Coefficients;
+	
+	public:
+	
+		qreal					lastHigh;
+		qreal					lastLow;
+		qreal					mean;
+		qreal					norm;
+		std::vector<HexCandlestick<qreal>>	normalisedCandlesticks;
+		
+		inline static qreal FirstCoefficient(void)
+		{
+			return (HexNormalisedInfo::Coefficients.empty() ? 1. : HexNormalisedInfo::Coefficients[0u]);
 		}
 		
-		HexNormalisedInfo(const HexNormalisedInfo& other) : norm(other.norm)
+		inline static std::vector<qreal> MakeCoefficients(qreal firstCoefficient, quint32 numberOfCandlesticks)
 		{
-			HexNormalisedInfo::normalisedCandlesticks.reserve(other.normalisedCandlesticks.size());
+			std::vector<qreal> coefficients;
+			coefficients.reserve(numberOfCandlesticks);
+			
+			const auto increment = (numberOfCandlesticks > 1u ? (1. - firstCoefficient)/static_cast<qreal>(numberOfCandlesticks - 1u) : 0.);
+			
+			for (auto i = 0u; i < numberOfCandlesticks; ++i)
+				coefficients.push_back(firstCoefficient + static_cast<qreal>(i)*increment);
+			
+			return coefficients;
+		}
+		
+		inline static HexNormalisedInfo Reversed(const HexNormalisedInfo& other)
+		{
+			std::vector<HexCandlestick<qreal>> candlesticks;
+			candlesticks.reserve(other.normalisedCandlesticks.size());
 			
 			for (const auto& cs : other.normalisedCandlesticks)
-				HexNormalisedInfo::normalisedCandlesticks.emplace_back(-cs.high, -cs.low);
+				candlesticks.emplace_back(-cs.high, -cs.low);
+			
+			return HexNormalisedInfo(-other.lastLow, -other.lastHigh, -other.mean, other.norm, std::move(candlesticks));
 		}
 		
-		qreal scalar(const HexNormalisedInfo& other) const
+		inline static void UpdateCoefficients(qreal firstCoefficient, quint32 numberOfCandlesticks)
 		{
-			auto it = other.normalisedCandlesticks.cbegin();
-			auto foo = 0.;
+			HexNormalisedInfo::Coefficients = HexNormalisedInfo::MakeCoefficients(firstCoefficient, numberOfCandlesticks);
+		}
+		
+		inline static bool SameCoefficients(qreal firstCoefficient, quint32 numberOfCandlesticks)
+		{
+			return (HexNormalisedInfo::Coefficients.size() == numberOfCandlesticks and not HexNormalisedInfo::Coefficients.empty() and HexNormalisedInfo::Coefficients[0u] == firstCoefficient);
+		}
+		
+		inline static bool Weighted(void)
+		{
+			return (not HexNormalisedInfo::Coefficients.empty() and HexNormalisedInfo::Coefficients[0u] != 1.);
+		}
+		
+		template<typename Type>
+		HexNormalisedInfo(Type it, quint32 timeUnit, quint32 numberOfCandlesticks) : HexNormalisedInfo(HexKernel<0u>(), it, timeUnit, numberOfCandlesticks)
+		{
+		}
+		
+		template<quint32 Size, bool Paired, bool Incremental, typename Type>
+		HexNormalisedInfo(HexKernel<Size, Paired, Incremental> kernel, Type it, quint32 timeUnit, quint32 numberOfCandlesticks) :
+			HexNormalisedInfo(kernel, it, timeUnit, numberOfCandlesticks, HexNormalisedInfo::Coefficients.data())
+		{
+		}
+		
+		template<quint32 Size, bool Paired, bool Incremental, typename Type>
+		HexNormalisedInfo(HexKernel<Size, Paired, Incremental>, Type it, quint32 timeUnit, quint32 numberOfCandlesticks, const qreal* coefficients) :
+			normalisedCandlesticks(HexKernel<Size, Paired, Incremental>::ExtractCandlesticks(it, timeUnit, numberOfCandlesticks))
+		{
+			const auto count = (Size != 0u ? Size : numberOfCandlesticks);
+			const auto candlesticks = HexNormalisedInfo::normalisedCandlesticks.data();
+			auto mean = 0.;
+			
+			for (auto i = 0u; i < count; ++i)
+				mean += candlesticks[i].low + candlesticks[i].high;
+			
+			HexNormalisedInfo::mean = mean/static_cast<qreal>(count*2u);
 			
-			if (HexNormalisedInfo::Coefficients[0u] != 1.)
+			HexNormalisedInfo::lastLow = candlesticks[count - 1u].low;
+			HexNormalisedInfo::lastHigh = candlesticks[count - 1u].high;
+			
+			mean /= static_cast<qreal>(count*2u);
+			auto scalar = 0.;
+			
+			for (auto i = 0u; i < count; ++i)
 			{
-				auto itc = HexNormalisedInfo::Coefficients.cbegin();
+				candlesticks[i].low -= mean;
+				candlesticks[i].high -= mean;
 				
-				for (const auto& cs : HexNormalisedInfo::normalisedCandlesticks)
-				{
-					foo += (cs.low*it->low + cs.high*it->high)*(*itc);
-					++it;
-					++itc;
-				}
+				scalar += (candlesticks[i].low*candlesticks[i].low + candlesticks[i].high*candlesticks[i].high)*coefficients[i];
 			}
-			else
+			
+			HexNormalisedInfo::norm = sqrtl(scalar);
+			
+			for (auto i = 0u; i < count; ++i)
 			{
-				for (const auto& cs : HexNormalisedInfo::normalisedCandlesticks)
-				{
-					foo += (cs.low*it->low + cs.high*it->high);
-					++it;
-				}
+				candlesticks[i].low /= HexNormalisedInfo::norm;
+				candlesticks[i].high /= HexNormalisedInfo::norm;
 			}
+		}
+		
+		HexNormalisedInfo(qreal high, qreal low, qreal m, qreal n, std::vector<HexCandlestick<qreal>>&& candlesticks) :
+			lastHigh(high),
+			lastLow(low),
+			mean(m),
+			norm(n),
+			normalisedCandlesticks(std::move(candlesticks))
+		{
+		}
+		
+		HexNormalisedInfo(const HexNormalisedInfo&) = default;
+		HexNormalisedInfo(HexNormalisedInfo&&) noexcept = default;
+		
+		HexNormalisedInfo& operator=(const HexNormalisedInfo&) = default;
+		HexNormalisedInfo& operator=(HexNormalisedInfo&&) noexcept = default;
+		
+		void correct(HexPartialInfo& partial, quint32 index, qreal deltaLow, qreal deltaHigh) const
+		{
+			const auto& cs = HexNormalisedInfo::normalisedCandlesticks[index];
+			const auto coefficient = HexNormalisedInfo::Coefficients[index];
 			
-			return foo;
+			partial.straight += (deltaLow*cs.low + deltaHigh*cs.high)*coefficient;
+			partial.reversed += (deltaHigh*cs.low + deltaLow*cs.high)*coefficient;
+		}
+		
+		template<class Kernel>
+		HexPartialInfo partials(const std::vector<HexCandlestick<qreal>>& query) const
+		{
+			return Kernel::Partials(query.data(), HexNormalisedInfo::normalisedCandlesticks.data(), HexNormalisedInfo::Coefficients.data(), HexNormalisedInfo::normalisedCandlesticks.size());
+		}
+		
+		template<class Kernel = HexKernel<0u>>
+		qreal scalar(const HexNormalisedInfo& other) const
+		{
+			return Kernel::Scalar(HexNormalisedInfo::normalisedCandlesticks.data(), other.normalisedCandlesticks.data(), HexNormalisedInfo::Coefficients.data(), HexNormalisedInfo::normalisedCandlesticks.size());
+		}
+		
+		template<class Kernel>
+		std::pair<qreal, qreal> scalars(const HexNormalisedInfo& reversedPattern, const HexNormalisedInfo& other) const
+		{
+			if constexpr(Kernel::Paired)
+				return Kernel::ScalarPair(HexNormalisedInfo::normalisedCandlesticks.data(), other.normalisedCandlesticks.data(), HexNormalisedInfo::Coefficients.data(), HexNormalisedInfo::normalisedCandlesticks.size());
+			else
+				return { HexNormalisedInfo::scalar<Kernel>(other), reversedPattern.scalar<Kernel>(other) };
+		}
+		
+		std::pair<qreal, qreal> scalars(const HexPartialInfo& partial) const
+		{
+			const auto shift = HexNormalisedInfo::mean*partial.sum;
+			return { (partial.straight - shift)/HexNormalisedInfo::norm, (shift - partial.reversed)/HexNormalisedInfo::norm };
 		}
 };
 
@@ -264,6 +611,14 @@ class HexIterationFile
 		}
 };
 
+class HexPoolTask
+{
+	public:
+	
+		std::function<void(void)>	function;
+		qint64				enqueued;
+};
+
 class HexScanFile
 {
 	public:
@@ -335,8 +690,10 @@ class HexUpdateFile
 	public:
 	
 		std::vector<HexCandlestick<qreal>>	candlesticks;
+		std::shared_ptr<const HexDataSnapshot>	snapshot;
 		qreal					now;
 		
+		quint32					scope;
 		quint32					timeUnit;
 		quint32					feedingTimeUnit;
 		quint32					numberOfCandlesticks;
@@ -350,8 +707,10 @@ class HexUpdateFile
 		bool					bestOverGraduates;
 		bool					nemesis;
 		
-		HexUpdateFile(const std::vector<HexCandlestick<qreal>>& candlesticksToBeAnalysed, qreal n, quint32 tu, quint32 ftu, quint32 nc, quint32 cand, qreal thr, qreal tp, qreal sl, bool best, bool nms) :
+		HexUpdateFile(const std::vector<HexCandlestick<qreal>>& candlesticksToBeAnalysed, std::shared_ptr<const HexDataSnapshot> snp, qreal n, quint32 sc, quint32 tu, quint32 ftu, quint32 nc, quint32 cand, qreal thr, qreal tp, qreal sl, bool best, bool nms) :
+			snapshot(std::move(snp)),
 			now(n),
+			scope(sc),
 			timeUnit(tu),
 			feedingTimeUnit(ftu),
 			numberOfCandlesticks(nc),
@@ -374,30 +733,92 @@ class HexUpdateFile
 		}
 };
 
+class HexStageStatistics
+{
+	public:
+	
+		std::atomic<quint64>		frames = 0u;
+		std::atomic<quint64>		drops = 0u;
+		std::atomic<qint64>		totalTime = 0;
+		std::atomic<qint64>		lastTime = 0;
+		
+		inline static QString Name(StageEnum stage)
+		{
+			switch (stage)
+			{
+				case StageEnum::Capture:
+					return "Capture";
+				
+				case StageEnum::Parse:
+					return "Parse";
+				
+				case StageEnum::Search:
+					return "Search";
+				
+				case StageEnum::Publish:
+					return "Publish";
+				
+				default:
+					return "Total";
+			}
+		}
+		
+		inline qint64 averageTime(void) const
+		{
+			const auto n = HexStageStatistics::frames.load(std::memory_order_relaxed);
+			return (n != 0u ? HexStageStatistics::totalTime.load(std::memory_order_relaxed)/static_cast<qint64>(n) : 0);
+		}
+		
+		inline void drop(void)
+		{
+			HexStageStatistics::drops.fetch_add(1u, std::memory_order_relaxed);
+		}
+		
+		inline void record(qint64 nanoseconds)
+		{
+			HexStageStatistics::frames.fetch_add(1u, std::memory_order_relaxed);
+			HexStageStatistics::totalTime.fetch_add(nanoseconds, std::memory_order_relaxed);
+			HexStageStatistics::lastTime.store(nanoseconds, std::memory_order_relaxed);
+		}
+		
+		inline void reset(void)
+		{
+			HexStageStatistics::frames.store(0u, std::memory_order_relaxed);
+			HexStageStatistics::drops.store(0u, std::memory_order_relaxed);
+			HexStageStatistics::totalTime.store(0, std::memory_order_relaxed);
+			HexStageStatistics::lastTime.store(0, std::memory_order_relaxed);
+		}
+};
+
 class HexTerminalFile
 {
 	public:
 	
-		quint32		realTime = 0u;
-		quint32		timeSpot = ~0u;
+		quint32			realTime = 0u;
+		quint32			timeSpot = ~0u;
 		
-		qreal		gap = -1.f;
-		qreal		volatility = 0.f;
+		qreal			gap = -1.f;
+		qreal			volatility = 0.f;
 		
-		qreal		worstSimilarity = 0.f;
-		quint32		numberOfSamples = 0u;
+		qreal			worstSimilarity = 0.f;
+		quint32			numberOfSamples = 0u;
 		
-		QString		buy;
-		qreal 		buy70 = 0.f;
-		qreal		buy80 = 0.f;
-		qreal		buy90 = 0.f;
+		std::array<qreal, 8u>	buys = {};
+		qreal			buy70 = 0.f;
+		qreal			buy80 = 0.f;
+		qreal			buy90 = 0.f;
 		
-		quint32		ratio = 0u;
+		quint32			ratio = 0u;
+		quint32			numberOfBests = 0u;
 		
-		QString		sell;
-		qreal		sell70 = 0.f;
-		qreal		sell80 = 0.f;
-		qreal		sell90 = 0.f;
+		std::array<qreal, 8u>	sells = {};
+		qreal			sell70 = 0.f;
+		qreal			sell80 = 0.f;
+		qreal			sell90 = 0.f;
+		
+		std::array<char, 4u>	instrument = {};
+		
+		HexTerminalFile(void) = default;
 		
 		HexTerminalFile(quint32 rt, quint32 ts, qreal v) : realTime(rt), timeSpot(ts), volatility(static_cast<qreal>(v))
 		{
@@ -406,6 +827,18 @@ class HexTerminalFile
 		HexTerminalFile(quint32 rt, qreal g, qreal v) : realTime(rt), gap(static_cast<qreal>(g)), volatility(static_cast<qreal>(v))
 		{
 		}
+		
+		QString instrumentName(void) const
+		{
+			return QString::fromLatin1(HexTerminalFile::instrument.data(), static_cast<qsizetype>(strnlen(HexTerminalFile::instrument.data(), HexTerminalFile::instrument.size())));
+		}
+		
+		void setInstrument(const QString& name)
+		{
+			const auto latin = name.toLatin1();
+			HexTerminalFile::instrument.fill('\0');
+			std::memcpy(HexTerminalFile::instrument.data(), latin.constData(), std::min(static_cast<std::size_t>(latin.size()), HexTerminalFile::instrument.size()));
+		}
 };
 
 #endif
@@ -9,12 +9,12 @@ class QAnalysingThread : public QScalarThread
 	Q_OBJECT
 	
 	private:
-		
+	
 		quint32								startingSpot;
 		
 		inline void							runBest(void);
 		inline void							runGraduates(void);
-		inline void							updateTerminal(const HexScanReport&, quint32, qreal) const;
+		inline void							updateTerminal(const HexScanReport&, quint32, qreal);
 	
 	protected:
 	
@@ -22,29 +22,27 @@ class QAnalysingThread : public QScalarThread
 	
 	public:
 	
-		inline								QAnalysingThread(HexDataCenter&);
+		inline								QAnalysingThread(HexDataCenter&, HexWorkerPool&);
 		inline void							setUp(const HexCheckFile&, bool, bool, const std::vector<HexCandlestick<qreal>>&);
 };
 
-QAnalysingThread::QAnalysingThread(HexDataCenter& foo) : QScalarThread(foo)
+QAnalysingThread::QAnalysingThread(HexDataCenter& foo, HexWorkerPool& pool) : QScalarThread(foo, pool)
 {
 }
 
 void QAnalysingThread::run(void)
 {
 	QScalarThread::bestOverGraduates ? QAnalysingThread::runBest() : QAnalysingThread::runGraduates();
-	std::cout << "Scan " << (QScalarThread::shouldContinue ? "finished."s : "stopped."s) << std::endl;
+	std::cout << "Scan " << (QScalarThread::results.token.isCancelled() ? "stopped."s : "finished."s) << std::endl;
 }
 
 void QAnalysingThread::runBest(void)
 {
-	const auto invalid = not QScalarThread::dataCollection.importDirectory(QScalarThread::directory, QScalarThread::numberOfDays);
+	const auto invalid = not QScalarThread::dataCollection.acquire(QScalarThread::results, QScalarThread::directory, QScalarThread::numberOfDays, QScalarThread::timeUnit, QScalarThread::numberOfCandlesticks, QScalarThread::scope);
 	
 	if (invalid)
 		return;
 	
-	QScalarThread::dataCollection.setUpHistory(QScalarThread::timeUnit, QScalarThread::numberOfCandlesticks, QScalarThread::scope);
-	
 	const auto size = QScalarThread::candlesticksToBeAnalysed.size();
 	const auto numberOfElementaryCandlesticks = QScalarThread::timeUnit*QScalarThread::numberOfCandlesticks;
 	const auto timeLimit = size - numberOfElementaryCandlesticks;
@@ -53,15 +51,21 @@ void QAnalysingThread::runBest(void)
 	auto tradeTimeSpot = sampleTimeSpot + numberOfElementaryCandlesticks;
 	auto it = QScalarThread::candlesticksToBeAnalysed.cbegin() + QAnalysingThread::startingSpot;
 	
-	while (QScalarThread::shouldContinue and sampleTimeSpot < timeLimit)
+	while (not QScalarThread::results.token.isCancelled() and sampleTimeSpot < timeLimit)
 	{
 		const auto now = static_cast<qreal>(tradeTimeSpot)/static_cast<qreal>(size);
 		const auto volatility = QScalarThread::AssessVolatility(it + (numberOfElementaryCandlesticks - QScalarThread::VolatilityCandlesticks), QScalarThread::VolatilityCandlesticks);
 		
-		QScalarThread::dataCollection.locateBest(it, QScalarThread::timeUnit, 1u, QScalarThread::numberOfCandlesticks, QScalarThread::numberOfCandidates, now, QScalarThread::nemesis, true);
-		QScalarThread::dataCollection.quickStudy(QScalarThread::stopLoss);
+		QScalarThread::workers.run(QoSEnum::Batch, [&]()
+		{
+			QScalarThread::dataCollection.locateBest(QScalarThread::results, it, QScalarThread::timeUnit, 1u, QScalarThread::numberOfCandlesticks, QScalarThread::numberOfCandidates, now, QScalarThread::nemesis, true);
+			QScalarThread::dataCollection.quickStudy(QScalarThread::results, QScalarThread::stopLoss);
+		});
+		
+		if (QScalarThread::results.token.isCancelled())
+			break;
 		
-		const auto report = QScalarThread::dataCollection.scanReport(QScalarThread::takeProfit);
+		const auto report = QScalarThread::dataCollection.scanReport(QScalarThread::results, QScalarThread::takeProfit);
 		QAnalysingThread::updateTerminal(report, tradeTimeSpot, volatility);
 		
 		++sampleTimeSpot;
@@ -72,13 +76,11 @@ void QAnalysingThread::runBest(void)
 
 void QAnalysingThread::runGraduates(void)
 {
-	const auto invalid = not QScalarThread::dataCollection.importDirectory(QScalarThread::directory, QScalarThread::numberOfDays);
+	const auto invalid = not QScalarThread::dataCollection.acquire(QScalarThread::results, QScalarThread::directory, QScalarThread::numberOfDays, QScalarThread::timeUnit, QScalarThread::numberOfCandlesticks, QScalarThread::scope);
 	
 	if (invalid)
 		return;
 	
-	QScalarThread::dataCollection.setUpHistory(QScalarThread::timeUnit, QScalarThread::numberOfCandlesticks, QScalarThread::scope);
-	
 	const auto size = QScalarThread::candlesticksToBeAnalysed.size();
 	const auto numberOfElementaryCandlesticks = QScalarThread::timeUnit*QScalarThread::numberOfCandlesticks;
 	const auto timeLimit = size - numberOfElementaryCandlesticks;
@@ -87,15 +89,21 @@ void QAnalysingThread::runGraduates(void)
 	auto tradeTimeSpot = sampleTimeSpot + numberOfElementaryCandlesticks;
 	auto it = QScalarThread::candlesticksToBeAnalysed.cbegin() + QAnalysingThread::startingSpot;
 	
-	while (QScalarThread::shouldContinue and sampleTimeSpot < timeLimit)
+	while (not QScalarThread::results.token.isCancelled() and sampleTimeSpot < timeLimit)
 	{
 		const auto now = static_cast<qreal>(tradeTimeSpot)/static_cast<qreal>(size);
 		const auto volatility = QScalarThread::AssessVolatility(it + (numberOfElementaryCandlesticks - QScalarThread::VolatilityCandlesticks), QScalarThread::VolatilityCandlesticks);
 		
-		QScalarThread::dataCollection.locateGraduates(it, QScalarThread::timeUnit, 1u, QScalarThread::numberOfCandlesticks, QScalarThread::threshold, now, QScalarThread::nemesis, true);
-		QScalarThread::dataCollection.quickStudy(QScalarThread::stopLoss);
+		QScalarThread::workers.run(QoSEnum::Batch, [&]()
+		{
+			QScalarThread::dataCollection.locateGraduates(QScalarThread::results, it, QScalarThread::timeUnit, 1u, QScalarThread::numberOfCandlesticks, QScalarThread::threshold, now, QScalarThread::nemesis, true);
+			QScalarThread::dataCollection.quickStudy(QScalarThread::results, QScalarThread::stopLoss);
+		});
+		
+		if (QScalarThread::results.token.isCancelled())
+			break;
 		
-		const auto report = QScalarThread::dataCollection.scanReport(QScalarThread::takeProfit);
+		const auto report = QScalarThread::dataCollection.scanReport(QScalarThread::results, QScalarThread::takeProfit);
 		QAnalysingThread::updateTerminal(report, tradeTimeSpot, volatility);
 		
 		++sampleTimeSpot;
@@ -103,7 +111,7 @@ void QAnalysingThread::runGraduates(void)
 		++it;
 	}
 }
-						
+
 void QAnalysingThread::setUp(const HexCheckFile& report, bool best, bool nms, const std::vector<HexCandlestick<qreal>>& candlesticks)
 {
 	QScalarThread::generalSetUp(report, best, nms);
@@ -111,9 +119,9 @@ void QAnalysingThread::setUp(const HexCheckFile& report, bool best, bool nms, co
 	QAnalysingThread::startingSpot = report.tradeTimeSpot;
 }
 
-void QAnalysingThread::updateTerminal(const HexScanReport& report, quint32 tradeTimeSpot, qreal volatility) const
+void QAnalysingThread::updateTerminal(const HexScanReport& report, quint32 tradeTimeSpot, qreal volatility)
 {
-	HexTerminalFile* info = new HexTerminalFile(tradeTimeSpot*23'400u/QScalarThread::candlesticksToBeAnalysed.size(), tradeTimeSpot, volatility);
+	HexTerminalFile info(tradeTimeSpot*23'400u/QScalarThread::candlesticksToBeAnalysed.size(), tradeTimeSpot, volatility);
 	QScalarThread::generalTerminalUpdate(report, info);
 }
 
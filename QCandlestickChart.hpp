@@ -0,0 +1,185 @@
+#ifndef __CANDLESTICK_CHART_HPP__
+#define __CANDLESTICK_CHART_HPP__
+
+// Qt Libraries
+#include <QPaintEvent>
+#include <QPainter>
+#include <QResizeEvent>
+#include <QTransform>
+#include <QWidget>
+
+// Standard Libraries
+#include <limits>
+
+// Personal Libraries
+#include "OtherClasses.hpp"
+
+class QCandlestickChart : public QWidget
+{
+	Q_OBJECT
+	
+	private:
+	
+		static constexpr qreal				Body = 0.8;
+		static constexpr qreal				Margin = 0.05;
+		
+		std::vector<QRectF>				bodies;
+		std::vector<QRectF>				overlayBodies;
+		std::vector<HexCandlestick<qreal>>		overlay;
+		QTransform					transform;
+		quint32						numberOfRealCandlesticks = 0u;
+		qreal						realTop = 0.;
+		qreal						realBottom = 0.;
+		qreal						top = 0.;
+		qreal						bottom = 0.;
+		qreal						flat = 0.;
+		
+		inline void					updateOverlay(void);
+		inline void					updateTransform(void);
+	
+	protected:
+	
+		inline void					paintEvent(QPaintEvent*) override;
+		inline void					resizeEvent(QResizeEvent*) override;
+	
+	public:
+	
+		inline						QCandlestickChart(QWidget*);
+		inline void					clear(void);
+		inline void					setCandlesticks(const std::vector<HexCandlestick<qreal>>&, quint32, qreal);
+		inline void					setOverlay(const std::vector<HexCandlestick<qreal>>&);
+};
+
+QCandlestickChart::QCandlestickChart(QWidget* parent) : QWidget(parent)
+{
+	QWidget::setAttribute(Qt::WA_OpaquePaintEvent);
+	QCandlestickChart::bodies.reserve(400u);
+	QCandlestickChart::overlayBodies.reserve(400u);
+}
+
+void QCandlestickChart::clear(void)
+{
+	QCandlestickChart::bodies.clear();
+	QCandlestickChart::overlayBodies.clear();
+	QCandlestickChart::overlay.clear();
+	QWidget::update();
+}
+
+void QCandlestickChart::paintEvent(QPaintEvent*)
+{
+	QPainter painter(this);
+	painter.fillRect(QWidget::rect(), QColor(Qt::white));
+	
+	if (QCandlestickChart::bodies.empty())
+		return;
+	
+	painter.setTransform(QCandlestickChart::transform);
+	
+	for (const auto& body : QCandlestickChart::overlayBodies)
+		painter.fillRect(body, QColor(51, 153, 255, 70));
+	
+	const auto real = std::min(static_cast<std::size_t>(QCandlestickChart::numberOfRealCandlesticks), QCandlestickChart::bodies.size());
+	
+	for (auto i = 0u; i < real; ++i)
+		painter.fillRect(QCandlestickChart::bodies[i], QColor(153, 153, 153));
+	
+	for (auto i = real; i < QCandlestickChart::bodies.size(); ++i)
+		painter.fillRect(QCandlestickChart::bodies[i], QColor(204, 204, 204));
+}
+
+void QCandlestickChart::resizeEvent(QResizeEvent*)
+{
+	QCandlestickChart::updateTransform();
+}
+
+void QCandlestickChart::setCandlesticks(const std::vector<HexCandlestick<qreal>>& candlesticks, quint32 numberOfReal, qreal flatHeight)
+{
+	QCandlestickChart::bodies.clear();
+	QCandlestickChart::numberOfRealCandlesticks = numberOfReal;
+	QCandlestickChart::flat = flatHeight;
+	
+	auto minHeight = std::numeric_limits<qreal>::max();
+	auto maxHeight = -std::numeric_limits<qreal>::max();
+	auto x = 0.;
+	
+	for (const auto& c : candlesticks)
+	{
+		const auto body = (c.high != c.low ? QRectF(x + (1. - QCandlestickChart::Body)/2., -c.high, QCandlestickChart::Body, c.high - c.low)
+							: QRectF(x + (1. - QCandlestickChart::Body)/2., -c.high - flatHeight/2., QCandlestickChart::Body, flatHeight));
+		
+		QCandlestickChart::bodies.push_back(body);
+		minHeight = std::min(minHeight, body.top());
+		maxHeight = std::max(maxHeight, body.bottom());
+		
+		if (QCandlestickChart::bodies.size() == numberOfReal)
+		{
+			QCandlestickChart::realTop = minHeight;
+			QCandlestickChart::realBottom = maxHeight;
+		}
+		
+		x += 1.;
+	}
+	
+	if (QCandlestickChart::bodies.size() < numberOfReal)
+	{
+		QCandlestickChart::realTop = minHeight;
+		QCandlestickChart::realBottom = maxHeight;
+	}
+	
+	const auto spread = maxHeight - minHeight;
+	QCandlestickChart::top = minHeight - spread*QCandlestickChart::Margin;
+	QCandlestickChart::bottom = maxHeight + spread*QCandlestickChart::Margin;
+	
+	QCandlestickChart::updateOverlay();
+	QCandlestickChart::updateTransform();
+}
+
+void QCandlestickChart::setOverlay(const std::vector<HexCandlestick<qreal>>& candlesticks)
+{
+	QCandlestickChart::overlay = candlesticks;
+	QCandlestickChart::updateOverlay();
+	QWidget::update();
+}
+
+void QCandlestickChart::updateOverlay(void)
+{
+	QCandlestickChart::overlayBodies.clear();
+	
+	if (QCandlestickChart::overlay.empty() or QCandlestickChart::bodies.empty())
+		return;
+	
+	auto low = std::numeric_limits<qreal>::max();
+	auto high = -std::numeric_limits<qreal>::max();
+	
+	for (const auto& c : QCandlestickChart::overlay)
+	{
+		low = std::min(low, c.low);
+		high = std::max(high, c.high);
+	}
+	
+	const auto scale = (high != low ? (QCandlestickChart::realBottom - QCandlestickChart::realTop)/(high - low) : 1.);
+	auto x = 0.;
+	
+	for (const auto& c : QCandlestickChart::overlay)
+	{
+		const auto y = QCandlestickChart::realTop + (high - c.high)*scale - (c.high != c.low ? 0. : QCandlestickChart::flat/2.);
+		const auto height = (c.high != c.low ? (c.high - c.low)*scale : QCandlestickChart::flat);
+		
+		QCandlestickChart::overlayBodies.emplace_back(x, y, 1., height);
+		x += 1.;
+	}
+}
+
+void QCandlestickChart::updateTransform(void)
+{
+	if (QCandlestickChart::bodies.empty() or QCandlestickChart::bottom == QCandlestickChart::top)
+		return QWidget::update();
+	
+	const auto sx = static_cast<qreal>(QWidget::width())/static_cast<qreal>(QCandlestickChart::bodies.size());
+	const auto sy = static_cast<qreal>(QWidget::height())/(QCandlestickChart::bottom - QCandlestickChart::top);
+	
+	QCandlestickChart::transform = QTransform(sx, 0., 0., sy, 0., -QCandlestickChart::top*sy);
+	QWidget::update();
+}
+
+#endif
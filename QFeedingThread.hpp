@@ -3,10 +3,22 @@
 
 // Qt Libraries
 #include <QApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QElapsedTimer>
 #include <QScreen>
 #include <QSoundEffect>
 
+// Standard Libraries
+#include <deque>
+#include <memory>
+
 // Personal Libraries
+#include "HexCandleSource.hpp"
+#include "HexCaptureScheduler.hpp"
+#include "HexChartScanner.hpp"
+#include "HexFrameQueue.hpp"
+#include "HexSessionJournal.hpp"
 #include "QScalarThread.hpp"
 
 class QFeedingThread : public QScalarThread
@@ -14,7 +26,7 @@ class QFeedingThread : public QScalarThread
 	Q_OBJECT
 	
 	private:
-		
+	
 		static constexpr qint32						ChartLeftValue = 4'669;
 		static constexpr qint32						ChartRightValue = 5'120;
 		static constexpr qint32						ChartTopValue = 532;
@@ -23,30 +35,82 @@ class QFeedingThread : public QScalarThread
 		static constexpr qint32						ChartWidth = ChartRightValue - ChartLeftValue;
 		static constexpr qint32						ChartHeight = ChartBottomValue - ChartTopValue;
 		
-		static constexpr quint32						BlueColor = 4'284'914'175u;
-		static constexpr quint32						RedColor =  4'294'927'974u;
-		static constexpr quint32						GrayColor = 4'285'893'782u;
+		static constexpr qint32						StripWidth = 8;
+		static constexpr qint32						SentinelColumns = 4;
+		static constexpr qint64						ResyncInterval = 1'000'000'000;
+		static constexpr quint32						SessionCapacity = 23'400u;
 		
 		static const std::vector<qreal>					Gaps;
 		
 		inline static bool						Compare(const std::vector<HexCandlestick<qreal>>&, const std::vector<HexCandlestick<qreal>>&);
-		inline static std::vector<HexCandlestick<qreal>>			ExtractCandlesticks(std::vector<HexCandlestick<qreal>>::const_iterator, quint32, quint32);
 		inline static void						RoundToClosestQuarter(qreal&);
 		
 		std::vector<HexCandlestick<qreal>>				formattedCandlesticks;
+		std::vector<qint32>						blueTops;
+		std::vector<qint32>						redBottoms;
+		std::array<qint32, StripWidth>					stripTops;
+		std::array<qint32, StripWidth>					stripBottoms;
 		QSoundEffect							bipTone;
 		QSoundEffect							colorTone;
 		
+		HexFrameQueue<HexImageFrame>					imageQueue;
+		HexFrameQueue<HexCandleFrame>					candleQueue;
+		std::array<HexStageStatistics, 5u>				statistics;
+		HexCaptureScheduler						scheduler;
+		HexSessionJournal						journal;
+		QElapsedTimer							clock;
+		QThread*							captureStage = nullptr;
+		QThread*							parseStage = nullptr;
+		std::atomic<bool>						stagesRunning = false;
+		std::atomic<qint64>						latestChange = -1;
+		std::atomic<qint32>						stripLeft = -1;
+		std::atomic<bool>						sourceExhausted = false;
+		
+		std::vector<HexCandlestick<qreal>>				sessionCandlesticks;
+		std::shared_ptr<HexDayHistory>					today;
+		quint32								numberOfSessionCandlesticks = 0u;
+		quint32								numberOfSessions = 0u;
+		quint32								todaySession = 0u;
+		
+		std::deque<HexSearchBuffer>					companionResults;
+		QStringList							companions;
+		
+		std::vector<qint64>						replayLatencies;
+		std::vector<std::pair<qint32, quint32>>				alertTimeline;
+		QString								replayPath;
+		quint32								replaySpeed = 0u;
+		
 		qreal								currentGap = 1.;
 		quint32								numberOfBars = 0u;
 		quint32								feedingTimeUnit = 1u;
 		qint32								latestColorLine = 0;
+		qint32								chartWidth = 0;
+		qint32								grayTop = 0;
+		qint32								grayBottom = 0;
+		SourceEnum							source = SourceEnum::Screen;
 		
+		inline bool							acquireAll(void);
+		inline void							extendToday(quint32, quint32);
+		inline void							publish(const HexScanReport&, const HexCandleFrame&, qreal, qreal);
 		inline void							runBest(void);
+		inline void							runCapture(void);
 		inline void							runGraduates(void);
-		inline bool							updateCandlesticks(void);
+		inline void							runIngest(void);
+		inline void							runParse(void);
+		inline void							recordSession(const std::vector<HexCandlestick<qreal>>&, quint32);
+		inline void							replayDay(void);
+		inline void							replayJournal(void);
+		inline void							runReplay(void);
+		inline void							idle(void) const;
+		inline void							report(void) const;
+		inline void							startStages(void);
+		inline void							stopStages(void);
+		inline bool							parseChart(const QImage&);
+		inline bool							parseStrip(const QImage&, qint32);
+		inline void							searchAll(const std::function<void(HexSearchBuffer&)>&);
+		inline bool							updateCandlesticks(const HexImageFrame&, std::vector<HexCandlestick<qreal>>&);
 		inline void							updateGap(quint32);
-		inline quint32							updateTerminal(const HexScanReport&, quint32, qreal) const;
+		inline quint32							updateTerminal(const HexScanReport&, quint32, qreal, qreal, const QString&);
 	
 	protected:
 	
@@ -57,10 +121,12 @@ class QFeedingThread : public QScalarThread
 		static constexpr quint32						RealTimeCandlesticks = 300u;
 		
 		inline static bool						CheckGap(qreal);
-	
-		inline								QFeedingThread(HexDataCenter&);
+		
+		inline								QFeedingThread(HexDataCenter&, HexWorkerPool&);
 		inline void							setUp(const HexCheckFile&, qreal, bool, bool);
 		inline void							setVolume(qreal);
+		inline const HexStageStatistics&				stageStatistics(StageEnum) const;
+		inline void							stop(void) override;
 	
 	signals:
 	
@@ -68,14 +134,35 @@ class QFeedingThread : public QScalarThread
 		void								triggerTableUpdate(HexUpdateFile*);
 };
 
-QFeedingThread::QFeedingThread(HexDataCenter& foo) : QScalarThread(foo)
+QFeedingThread::QFeedingThread(HexDataCenter& foo, HexWorkerPool& pool) : QScalarThread(foo, pool)
 {
+	QScalarThread::results.incremental = true;
 	QFeedingThread::formattedCandlesticks.reserve(400u);
+	QFeedingThread::sessionCandlesticks.resize(QFeedingThread::SessionCapacity);
+	QFeedingThread::blueTops.reserve(QFeedingThread::ChartWidth);
+	QFeedingThread::redBottoms.reserve(QFeedingThread::ChartWidth);
 	
 	QFeedingThread::bipTone.setSource(QUrl::fromLocalFile("sounds/ring.wav"));
 	QFeedingThread::colorTone.setSource(QUrl::fromLocalFile("sounds/puzzle.wav"));
 }
 
+bool QFeedingThread::acquireAll(void)
+{
+	// A replayed input file must not find its own future among the precedents, in any instrument.
+	const auto excluded = (QFeedingThread::source == SourceEnum::Replay and QFeedingThread::replayPath.startsWith("input/") ? QFileInfo(QFeedingThread::replayPath).fileName() : QString());
+	
+	if (not QScalarThread::dataCollection.acquire(QScalarThread::results, QScalarThread::directory, QScalarThread::numberOfDays, QScalarThread::timeUnit, QScalarThread::numberOfCandlesticks, QScalarThread::scope, excluded))
+		return false;
+	
+	for (auto i = 0u; i < QFeedingThread::companionResults.size(); ++i)
+	{
+		if (not QScalarThread::dataCollection.acquire(QFeedingThread::companionResults[i], QFeedingThread::companions[i], QScalarThread::numberOfDays, QScalarThread::timeUnit, QScalarThread::numberOfCandlesticks, QScalarThread::scope, excluded))
+			return false;
+	}
+	
+	return true;
+}
+
 bool QFeedingThread::CheckGap(qreal value)
 {
 	for (const auto& v : QFeedingThread::Gaps)
@@ -105,145 +192,609 @@ bool QFeedingThread::Compare(const std::vector<HexCandlestick<qreal>>& v1, const
 	return false;
 }
 
-std::vector<HexCandlestick<qreal>> QFeedingThread::ExtractCandlesticks(std::vector<HexCandlestick<qreal>>::const_iterator it, quint32 timeUnit, quint32 numberOfCandlesticks)
+void QFeedingThread::RoundToClosestQuarter(qreal& value)
+{
+	const auto rounded = (static_cast<qint64>(value*100. + 12.5)/25LL)*25LL;
+	value = static_cast<qreal>(rounded)/100.;
+}
+
+void QFeedingThread::idle(void) const
+{
+	if (QFeedingThread::source == SourceEnum::Replay)
+		QThread::yieldCurrentThread();
+	else
+		QThread::msleep(1);
+}
+
+bool QFeedingThread::parseChart(const QImage& img)
 {
-	std::vector<HexCandlestick<qreal>> candlesticks;
-	candlesticks.reserve(numberOfCandlesticks);
+	if (img.width() < QFeedingThread::ChartWidth or img.height() < QFeedingThread::ChartHeight)
+		return false;
+	
+	const auto realWidth = HexChartScanner::FindColor(reinterpret_cast<const quint32*>(img.constScanLine(0)), QFeedingThread::ChartWidth, HexChartScanner::GrayColor);
+	
+	if (realWidth + 1 >= QFeedingThread::ChartWidth)
+		return false;
+	
+	auto top = 0;
+	auto bottom = 0;
+	const auto numberOfGrayBars = HexChartScanner::CountGrayBars(img, realWidth + 1, QFeedingThread::ChartHeight, top, bottom);
 	
-	for (auto i = 0u; i < numberOfCandlesticks; ++i)
+	if (numberOfGrayBars < 2u)
+		return false;
+	else if (QFeedingThread::numberOfBars == 0u)
+		QFeedingThread::numberOfBars = numberOfGrayBars;
+	
+	QFeedingThread::updateGap(numberOfGrayBars);
+	QFeedingThread::numberOfBars = numberOfGrayBars;
+	QFeedingThread::chartWidth = realWidth;
+	QFeedingThread::grayTop = top;
+	QFeedingThread::grayBottom = bottom;
+	
+	QFeedingThread::blueTops.assign(realWidth, -1);
+	QFeedingThread::redBottoms.assign(realWidth, -1);
+	
+	for (auto y = 0; y < QFeedingThread::ChartHeight; ++y)
+		HexChartScanner::ScanLine(reinterpret_cast<const quint32*>(img.constScanLine(y)), realWidth, y, QFeedingThread::blueTops.data(), QFeedingThread::redBottoms.data());
+	
+	return true;
+}
+
+bool QFeedingThread::parseStrip(const QImage& img, qint32 left)
+{
+	if (left + QFeedingThread::StripWidth != QFeedingThread::chartWidth)
+		return false;
+	
+	if (img.width() < QFeedingThread::StripWidth + 2 or img.height() < QFeedingThread::ChartHeight)
+		return false;
+	
+	const auto scrolled = (HexChartScanner::FindColor(reinterpret_cast<const quint32*>(img.constScanLine(0)), QFeedingThread::StripWidth + 1, HexChartScanner::GrayColor) != QFeedingThread::StripWidth);
+	
+	if (scrolled)
+		return false;
+	
+	auto top = 0;
+	auto bottom = 0;
+	const auto numberOfGrayBars = HexChartScanner::CountGrayBars(img, QFeedingThread::StripWidth + 1, QFeedingThread::ChartHeight, top, bottom);
+	
+	if (numberOfGrayBars != QFeedingThread::numberOfBars or top != QFeedingThread::grayTop or bottom != QFeedingThread::grayBottom)
+		return false;
+	
+	QFeedingThread::stripTops.fill(-1);
+	QFeedingThread::stripBottoms.fill(-1);
+	
+	for (auto y = 0; y < QFeedingThread::ChartHeight; ++y)
+		HexChartScanner::ScanLine(reinterpret_cast<const quint32*>(img.constScanLine(y)), QFeedingThread::StripWidth, y, QFeedingThread::stripTops.data(), QFeedingThread::stripBottoms.data());
+	
+	for (auto x = 0; x < QFeedingThread::SentinelColumns; ++x)
 	{
-		auto& cs = candlesticks.emplace_back(it->low, it->high);
-		++it;
+		if (QFeedingThread::stripTops[x] != QFeedingThread::blueTops[left + x] or QFeedingThread::stripBottoms[x] != QFeedingThread::redBottoms[left + x])
+			return false;
+	}
+	
+	std::copy(QFeedingThread::stripTops.cbegin() + QFeedingThread::SentinelColumns, QFeedingThread::stripTops.cend(), QFeedingThread::blueTops.begin() + left + QFeedingThread::SentinelColumns);
+	std::copy(QFeedingThread::stripBottoms.cbegin() + QFeedingThread::SentinelColumns, QFeedingThread::stripBottoms.cend(), QFeedingThread::redBottoms.begin() + left + QFeedingThread::SentinelColumns);
+	return true;
+}
+
+void QFeedingThread::extendToday(quint32 end, quint32 session)
+{
+	if (QScalarThread::results.today == nullptr)
+		return;
+	
+	// The source restarted: windows built from the previous session must not be searched along with this one.
+	if (session != QFeedingThread::todaySession)
+	{
+		QFeedingThread::todaySession = session;
+		QFeedingThread::today = std::make_shared<HexDayHistory>(QDate::currentDate().toString("ddd dd MMM"), QScalarThread::timeUnit, QScalarThread::numberOfCandlesticks);
+		QScalarThread::results.today = QFeedingThread::today;
+	}
+	
+	HexKernelSwitch::Dispatch(QScalarThread::numberOfCandlesticks, [&](auto kernel)
+	{
+		QFeedingThread::today->extend<decltype(kernel)>(QFeedingThread::sessionCandlesticks, end);
+	});
+}
+
+void QFeedingThread::publish(const HexScanReport& report, const HexCandleFrame& frame, qreal now, qreal volatility)
+{
+	const auto start = QFeedingThread::clock.nsecsElapsed();
+	const auto secsFromRef = frame.secsFromRef;
+	const auto realTime = (secsFromRef > 0 ? static_cast<quint32>(secsFromRef) : 0u);
+	auto result = QFeedingThread::updateTerminal(report, realTime, frame.gap, volatility, (QFeedingThread::companions.isEmpty() ? QString() : QScalarThread::directory));
+	
+	// Each instrument is judged on its own precedents, whose profits are already scaled to the live pattern by
+	// the norm ratio; a companion can only hold the alert back, never add samples to the primary's.
+	for (auto i = 0u; i < QFeedingThread::companionResults.size(); ++i)
+	{
+		const auto companion = QScalarThread::dataCollection.scanReport(QFeedingThread::companionResults[i], QScalarThread::takeProfit);
+		result = std::min(QFeedingThread::updateTerminal(companion, realTime, frame.gap, volatility, QFeedingThread::companions[i]), result);
+	}
+	
+	const auto replaying = (QFeedingThread::source == SourceEnum::Replay);
+	
+	if (replaying and result != 0u)
+		QFeedingThread::alertTimeline.emplace_back(secsFromRef, result);
+	
+	if (result == 2u and replaying)
+		QFeedingThread::latestColorLine = secsFromRef;
+	else if (result == 2u)
+	{
+		const auto updateFile = new HexUpdateFile(QScalarThread::candlesticksToBeAnalysed, QScalarThread::results.snapshot, now,
+								QScalarThread::scope, QScalarThread::timeUnit, QFeedingThread::feedingTimeUnit, QScalarThread::numberOfCandlesticks,
+								QScalarThread::numberOfCandidates, QScalarThread::threshold,
+								QScalarThread::takeProfit, QScalarThread::stopLoss,
+								QScalarThread::bestOverGraduates, QScalarThread::nemesis);
+		
+		QFeedingThread::triggerTableUpdate(updateFile);
+		QFeedingThread::latestColorLine = secsFromRef;
+		QFeedingThread::bipTone.play();
+	}
+	else if (result != 0u and QFeedingThread::latestColorLine + 10 < secsFromRef)
+	{
+		QFeedingThread::latestColorLine = secsFromRef;
+		
+		if (not replaying)
+			QFeedingThread::colorTone.play();
+	}
+	
+	const auto end = QFeedingThread::clock.nsecsElapsed();
+	QFeedingThread::statistics[static_cast<quint32>(StageEnum::Publish)].record(end - start);
+	QFeedingThread::statistics[static_cast<quint32>(StageEnum::Total)].record(end - frame.timestamp);
+	
+	if (replaying)
+		QFeedingThread::replayLatencies.push_back(end - frame.timestamp);
+}
+
+void QFeedingThread::recordSession(const std::vector<HexCandlestick<qreal>>& candlesticks, quint32 end)
+{
+	end = std::min(end, QFeedingThread::SessionCapacity);
+	
+	for (auto i = QFeedingThread::numberOfSessionCandlesticks; i < end; ++i)
+		QFeedingThread::sessionCandlesticks[i] = candlesticks[i];
+	
+	QFeedingThread::numberOfSessionCandlesticks = std::max(end, QFeedingThread::numberOfSessionCandlesticks);
+}
+
+void QFeedingThread::replayDay(void)
+{
+	QFile replayFile(QFeedingThread::replayPath);
+	
+	if (!replayFile.open(QIODevice::ReadOnly | QIODevice::Text))
+	{
+		std::cout << "Could not read file [" << QFeedingThread::replayPath.toStdString() + "]." << std::endl;
+		return;
+	}
+	
+	QTextStream fileReader(&replayFile);
+	std::vector<HexCandlestick<qreal>> replayCandlesticks;
+	replayCandlesticks.reserve(23'400u);
+	
+	if (QFeedingThread::replayPath.startsWith("input/"))
+	{
+		fileReader.readLine();
+		fileReader.readLine();
+	}
+	
+	while (!fileReader.atEnd())
+	{
+		const auto numbers = fileReader.readLine().split(' ');
 		
-		for (auto j = 1u; j < timeUnit; ++j)
+		if (numbers.size() == 2u)
+			replayCandlesticks.emplace_back(numbers[0u].toDouble(), numbers[1u].toDouble());
+	}
+	
+	const auto numberOfElementaryCandlesticks = QScalarThread::timeUnit*QScalarThread::numberOfCandlesticks/QFeedingThread::feedingTimeUnit;
+	const auto numberOfRecentCandlesticks = std::max(numberOfElementaryCandlesticks, QScalarThread::VolatilityCandlesticks);
+	const auto numberOfReplayCandlesticks = replayCandlesticks.size();
+	const auto replayStart = QFeedingThread::clock.nsecsElapsed();
+	auto& captureStatistics = QFeedingThread::statistics[static_cast<quint32>(StageEnum::Capture)];
+	
+	std::cout << "Replaying " << numberOfReplayCandlesticks << " bars at " << (QFeedingThread::replaySpeed != 0u ? std::to_string(QFeedingThread::replaySpeed) + "x" : std::string("full speed")) << '.' << std::endl;
+	
+	for (auto end = numberOfRecentCandlesticks; end <= numberOfReplayCandlesticks and QFeedingThread::stagesRunning.load(std::memory_order_acquire); ++end)
+	{
+		const auto secsFromRef = static_cast<qint32>(static_cast<quint64>(end)*23'400u/numberOfReplayCandlesticks);
+		
+		if (QFeedingThread::replaySpeed != 0u)
 		{
-			if (it->low < cs.low)
-				cs.low = it->low;
+			const auto due = replayStart + static_cast<qint64>(end - numberOfRecentCandlesticks)*1'000'000'000/static_cast<qint64>(QFeedingThread::replaySpeed);
 			
-			if (it->high > cs.high)
-				cs.high = it->high;
+			while (QFeedingThread::clock.nsecsElapsed() < due and QFeedingThread::stagesRunning.load(std::memory_order_acquire))
+				QThread::usleep(static_cast<unsigned long>(std::min(static_cast<qint64>(1'000), (due - QFeedingThread::clock.nsecsElapsed())/1'000 + 1)));
+		}
+		
+		const auto start = QFeedingThread::clock.nsecsElapsed();
+		const auto last = replayCandlesticks.cbegin() + end;
+		
+		auto finalCandlesticks = HexKernelSwitch::Dispatch(QScalarThread::numberOfCandlesticks, [&](auto kernel)
+		{
+			return decltype(kernel)::ExtractCandlesticks(last - numberOfElementaryCandlesticks, QScalarThread::timeUnit/QFeedingThread::feedingTimeUnit, QScalarThread::numberOfCandlesticks);
+		});
+		
+		const auto somethingChanged = QFeedingThread::Compare(finalCandlesticks, QFeedingThread::formattedCandlesticks);
+		captureStatistics.record(QFeedingThread::clock.nsecsElapsed() - start);
+		
+		if (not somethingChanged)
+			continue;
+		
+		while (QFeedingThread::candleQueue.pending() and QFeedingThread::stagesRunning.load(std::memory_order_acquire))
+			QThread::yieldCurrentThread();
+		
+		QFeedingThread::formattedCandlesticks.swap(finalCandlesticks);
+		
+		QFeedingThread::recordSession(replayCandlesticks, end);
+		
+		auto& frame = QFeedingThread::candleQueue.next();
+		frame.candlesticks.assign(last - numberOfRecentCandlesticks, last);
+		frame.gap = QFeedingThread::currentGap;
+		frame.secsFromRef = secsFromRef;
+		frame.timestamp = QFeedingThread::clock.nsecsElapsed();
+		frame.sessionSize = QFeedingThread::numberOfSessionCandlesticks;
+		frame.session = QFeedingThread::numberOfSessions;
+		QFeedingThread::candleQueue.push();
+	}
+}
+
+void QFeedingThread::replayJournal(void)
+{
+	auto timeUnit = 0u;
+	auto numberOfCandlesticks = 0u;
+	auto feedingTimeUnit = 0u;
+	
+	if (not QFeedingThread::journal.open(QFeedingThread::replayPath, timeUnit, numberOfCandlesticks, feedingTimeUnit, QFeedingThread::currentGap))
+		return;
+	
+	if (timeUnit != QScalarThread::timeUnit or numberOfCandlesticks != QScalarThread::numberOfCandlesticks or feedingTimeUnit != QFeedingThread::feedingTimeUnit)
+	{
+		std::cout << "Journal was recorded with TU " << timeUnit << ", NC " << numberOfCandlesticks << " and feeding unit " << feedingTimeUnit << '.' << std::endl;
+		QFeedingThread::journal.close();
+		return;
+	}
+	
+	HexJournalEntry entry;
+	auto firstTimestamp = static_cast<qint64>(-1);
+	const auto replayStart = QFeedingThread::clock.nsecsElapsed();
+	
+	std::cout << "Replaying journal at " << (QFeedingThread::replaySpeed != 0u ? std::to_string(QFeedingThread::replaySpeed) + "x" : std::string("full speed")) << '.' << std::endl;
+	
+	while (QFeedingThread::stagesRunning.load(std::memory_order_acquire) and QFeedingThread::journal.read(entry))
+	{
+		if (firstTimestamp < 0)
+			firstTimestamp = entry.timestamp;
+		
+		if (QFeedingThread::replaySpeed != 0u)
+		{
+			const auto due = replayStart + (entry.timestamp - firstTimestamp)/static_cast<qint64>(QFeedingThread::replaySpeed);
 			
-			++it;
+			while (QFeedingThread::clock.nsecsElapsed() < due and QFeedingThread::stagesRunning.load(std::memory_order_acquire))
+				QThread::usleep(static_cast<unsigned long>(std::min(static_cast<qint64>(1'000), (due - QFeedingThread::clock.nsecsElapsed())/1'000 + 1)));
+		}
+		
+		if (entry.type == HexSessionJournal::GapRecord)
+		{
+			QFeedingThread::currentGap = entry.gap;
+			std::cout << " >> Gap changed to " << entry.gap << '.' << std::endl;
+			continue;
 		}
+		
+		while (QFeedingThread::candleQueue.pending() and QFeedingThread::stagesRunning.load(std::memory_order_acquire))
+			QThread::yieldCurrentThread();
+		
+		auto& frame = QFeedingThread::candleQueue.next();
+		frame.candlesticks = entry.candlesticks;
+		frame.gap = entry.gap;
+		frame.secsFromRef = entry.secsFromRef;
+		frame.timestamp = QFeedingThread::clock.nsecsElapsed();
+		QFeedingThread::candleQueue.push();
 	}
 	
-	return candlesticks;
+	QFeedingThread::journal.close();
 }
 
-void QFeedingThread::RoundToClosestQuarter(qreal& value)
+void QFeedingThread::report(void) const
 {
-	const auto rounded = (static_cast<qint64>(value*100. + 12.5)/25LL)*25LL;
-	value = static_cast<qreal>(rounded)/100.;
+	for (auto stage : { StageEnum::Capture, StageEnum::Parse, StageEnum::Search, StageEnum::Publish, StageEnum::Total })
+	{
+		const auto& stats = QFeedingThread::stageStatistics(stage);
+		std::cout << " >> " << HexStageStatistics::Name(stage).toStdString() << ": " << stats.frames.load() << " frames, " << stats.drops.load() << " dropped, ";
+		std::cout << stats.averageTime()/1'000 << " us average, " << stats.lastTime.load()/1'000 << " us last." << std::endl;
+	}
+	
+	std::cout << " >> Live searches over latency target: " << QScalarThread::workers.takeLateTasks() << '.' << std::endl;
+	
+	if (QFeedingThread::source == SourceEnum::Screen)
+		QFeedingThread::scheduler.report();
+	
+	if (QFeedingThread::source != SourceEnum::Replay or QFeedingThread::replayLatencies.empty())
+		return;
+	
+	auto latencies = QFeedingThread::replayLatencies;
+	std::sort(latencies.begin(), latencies.end());
+	
+	const auto percentile = [&](qreal p){ return latencies[static_cast<quint64>(p*static_cast<qreal>(latencies.size() - 1u))]/1'000; };
+	std::cout << " >> Replay latency over " << latencies.size() << " bars: p50 " << percentile(0.5) << " us, p90 " << percentile(0.9) << " us, p99 " << percentile(0.99) << " us, max " << latencies.back()/1'000 << " us." << std::endl;
+	std::cout << " >> Replay alerts: " << QFeedingThread::alertTimeline.size() << '.' << std::endl;
+	
+	const auto refTime = QTime(15, 30, 0);
+	
+	for (const auto& [secsFromRef, result] : QFeedingThread::alertTimeline)
+		std::cout << "    " << refTime.addSecs(secsFromRef).toString("hh:mm:ss").toStdString() << (result == 2u ? " [Alert]" : " [Color]") << std::endl;
 }
 
 void QFeedingThread::run(void)
 {
-	QScalarThread::bestOverGraduates ? QFeedingThread::runBest() : QFeedingThread::runGraduates();	
+	QScalarThread::bestOverGraduates ? QFeedingThread::runBest() : QFeedingThread::runGraduates();
+	QFeedingThread::stopStages();
 	std::cout << "Feed stopped." << std::endl;
 }
 
 void QFeedingThread::runBest(void)
 {
-	const auto invalid = not QScalarThread::dataCollection.importDirectory(QScalarThread::directory, QScalarThread::numberOfDays);
+	const auto invalid = not QFeedingThread::acquireAll();
 	
 	if (invalid)
 		return;
 	
-	QScalarThread::dataCollection.setUpHistory(QScalarThread::timeUnit, QScalarThread::numberOfCandlesticks, QScalarThread::scope);
+	QFeedingThread::startStages();
 	
 	const auto numberOfElementaryCandlesticks = QScalarThread::timeUnit*QScalarThread::numberOfCandlesticks/QFeedingThread::feedingTimeUnit;
+	auto& searchStatistics = QFeedingThread::statistics[static_cast<quint32>(StageEnum::Search)];
+	
+	while (not QScalarThread::results.token.isCancelled())
+	{
+		if (not QFeedingThread::candleQueue.pop())
+		{
+			if (QFeedingThread::sourceExhausted.load(std::memory_order_acquire))
+				break;
+			
+			QFeedingThread::idle();
+			continue;
+		}
+		
+		const auto start = QFeedingThread::clock.nsecsElapsed();
+		auto& frame = QFeedingThread::candleQueue.current();
+		QScalarThread::candlesticksToBeAnalysed.swap(frame.candlesticks);
+		
+		const auto now = static_cast<qreal>(frame.secsFromRef)/23'400.;
+		const auto volatility = QScalarThread::AssessVolatility(QScalarThread::candlesticksToBeAnalysed.cend() - QScalarThread::VolatilityCandlesticks, QScalarThread::VolatilityCandlesticks);
+		QFeedingThread::extendToday(frame.sessionSize, frame.session);
+		
+		QFeedingThread::searchAll([&](HexSearchBuffer& buffer)
+		{
+			QScalarThread::dataCollection.locateBest(buffer, QScalarThread::candlesticksToBeAnalysed.cend() - numberOfElementaryCandlesticks, QScalarThread::timeUnit, QFeedingThread::feedingTimeUnit, QScalarThread::numberOfCandlesticks, QScalarThread::numberOfCandidates, now, QScalarThread::nemesis, true);
+			QScalarThread::dataCollection.quickStudy(buffer, QScalarThread::stopLoss);
+		});
+		
+		if (QScalarThread::results.token.isCancelled())
+			break;
+		
+		const auto report = QScalarThread::dataCollection.scanReport(QScalarThread::results, QScalarThread::takeProfit);
+		searchStatistics.record(QFeedingThread::clock.nsecsElapsed() - start);
+		QFeedingThread::publish(report, frame, now, volatility);
+	}
+}
+
+void QFeedingThread::runCapture(void)
+{
 	const auto refTime = QTime(15, 30, 0);
+	auto& captureStatistics = QFeedingThread::statistics[static_cast<quint32>(StageEnum::Capture)];
+	auto& parseStatistics = QFeedingThread::statistics[static_cast<quint32>(StageEnum::Parse)];
+	auto previousStart = static_cast<qint64>(-1);
+	auto latestResync = static_cast<qint64>(0);
 	
-	while (QScalarThread::shouldContinue)
+	while (QFeedingThread::stagesRunning.load(std::memory_order_acquire))
 	{
-		const auto timeNow = QTime::currentTime();
-		const auto secsFromRef = refTime.secsTo(timeNow);
-		const auto somethingNew = QFeedingThread::updateCandlesticks();
+		const auto start = QFeedingThread::clock.nsecsElapsed();
+		const auto left = QFeedingThread::stripLeft.load(std::memory_order_acquire);
+		auto& frame = QFeedingThread::imageQueue.next();
 		
-		if (somethingNew)
+		frame.secsFromRef = refTime.secsTo(QTime::currentTime());
+		frame.timestamp = start;
+		frame.interval = (previousStart >= 0 ? start - previousStart : 0);
+		previousStart = start;
+		frame.full = (left < 0 or start - latestResync >= QFeedingThread::ResyncInterval);
+		frame.left = (frame.full ? 0 : left);
+		
+		if (frame.full)
 		{
-			const auto now = static_cast<qreal>(secsFromRef)/23'400.;
-			const auto volatility = QScalarThread::AssessVolatility(QScalarThread::candlesticksToBeAnalysed.cend() - QScalarThread::VolatilityCandlesticks, QScalarThread::VolatilityCandlesticks);
-			
-			QScalarThread::dataCollection.locateBest(QScalarThread::candlesticksToBeAnalysed.cend() - numberOfElementaryCandlesticks, QScalarThread::timeUnit, QFeedingThread::feedingTimeUnit, QScalarThread::numberOfCandlesticks, QScalarThread::numberOfCandidates, now, QScalarThread::nemesis, true);
-			QScalarThread::dataCollection.quickStudy(QScalarThread::stopLoss);
-			
-			const auto report = QScalarThread::dataCollection.scanReport(QScalarThread::takeProfit);
-			const auto result = QFeedingThread::updateTerminal(report, (secsFromRef > 0 ? static_cast<quint32>(secsFromRef) : 0u), volatility);
-			
-			if (result == 2u)
-			{
-				const auto updateFile = new HexUpdateFile(QScalarThread::candlesticksToBeAnalysed, now,
-										QScalarThread::timeUnit, QFeedingThread::feedingTimeUnit, QScalarThread::numberOfCandlesticks,
-										QScalarThread::numberOfCandidates, QScalarThread::threshold,
-										QScalarThread::takeProfit, QScalarThread::stopLoss,
-										QScalarThread::bestOverGraduates, QScalarThread::nemesis);
-				
-				QFeedingThread::triggerTableUpdate(updateFile);
-				QFeedingThread::latestColorLine = secsFromRef;
-				QFeedingThread::bipTone.play();
-			}
-			else if (result != 0u and QFeedingThread::latestColorLine + 10 < secsFromRef)
-			{
-				QFeedingThread::latestColorLine = secsFromRef;
-				QFeedingThread::colorTone.play();
-			}
+			latestResync = start;
+			frame.image = QGuiApplication::primaryScreen()->grabWindow(0, QFeedingThread::ChartLeftValue, QFeedingThread::ChartTopValue, QFeedingThread::ChartWidth, QFeedingThread::ChartHeight).toImage();
 		}
 		else
-			QThread::msleep(50);
+			frame.image = QGuiApplication::primaryScreen()->grabWindow(0, QFeedingThread::ChartLeftValue + left, QFeedingThread::ChartTopValue, QFeedingThread::StripWidth + 2, QFeedingThread::ChartHeight).toImage();
+		
+		captureStatistics.record(QFeedingThread::clock.nsecsElapsed() - start);
+		
+		if (QFeedingThread::imageQueue.push())
+			parseStatistics.drop();
+		
+		const auto msecsFromRef = refTime.msecsTo(QTime::currentTime());
+		const auto delay = QFeedingThread::scheduler.delay(msecsFromRef, QFeedingThread::clock.nsecsElapsed(), QFeedingThread::latestChange.load(std::memory_order_relaxed));
+		
+		if (delay != 0u)
+			QThread::msleep(delay);
 	}
 }
 
 void QFeedingThread::runGraduates(void)
 {
-	const auto invalid = not QScalarThread::dataCollection.importDirectory(QScalarThread::directory, QScalarThread::numberOfDays);
+	const auto invalid = not QFeedingThread::acquireAll();
 	
 	if (invalid)
 		return;
 	
-	QScalarThread::dataCollection.setUpHistory(QScalarThread::timeUnit, QScalarThread::numberOfCandlesticks, QScalarThread::scope);
+	QFeedingThread::startStages();
 	
 	const auto numberOfElementaryCandlesticks = QScalarThread::timeUnit*QScalarThread::numberOfCandlesticks/QFeedingThread::feedingTimeUnit;
-	const auto refTime = QTime(15, 30, 0);
+	auto& searchStatistics = QFeedingThread::statistics[static_cast<quint32>(StageEnum::Search)];
 	
-	while (QScalarThread::shouldContinue)
+	while (not QScalarThread::results.token.isCancelled())
 	{
-		const auto timeNow = QTime::currentTime();
-		const auto secsFromRef = refTime.secsTo(timeNow);
-		const auto somethingNew = QFeedingThread::updateCandlesticks();
-		
-		if (somethingNew)
+		if (not QFeedingThread::candleQueue.pop())
 		{
-			const auto now = static_cast<qreal>(secsFromRef)/23'400.;
-			const auto volatility = QScalarThread::AssessVolatility(QScalarThread::candlesticksToBeAnalysed.cend() - QScalarThread::VolatilityCandlesticks, QScalarThread::VolatilityCandlesticks);
+			if (QFeedingThread::sourceExhausted.load(std::memory_order_acquire))
+				break;
 			
-			QScalarThread::dataCollection.locateGraduates(QScalarThread::candlesticksToBeAnalysed.cend() - numberOfElementaryCandlesticks, QScalarThread::timeUnit, QFeedingThread::feedingTimeUnit, QScalarThread::numberOfCandlesticks, QScalarThread::threshold, now, QScalarThread::nemesis, true);
-			QScalarThread::dataCollection.quickStudy(QScalarThread::stopLoss);
-			
-			const auto report = QScalarThread::dataCollection.scanReport(QScalarThread::takeProfit);
-			const auto result = QFeedingThread::updateTerminal(report, (secsFromRef > 0 ? static_cast<quint32>(secsFromRef) : 0u), volatility);
+			QFeedingThread::idle();
+			continue;
+		}
+		
+		const auto start = QFeedingThread::clock.nsecsElapsed();
+		auto& frame = QFeedingThread::candleQueue.current();
+		QScalarThread::candlesticksToBeAnalysed.swap(frame.candlesticks);
+		
+		const auto now = static_cast<qreal>(frame.secsFromRef)/23'400.;
+		const auto volatility = QScalarThread::AssessVolatility(QScalarThread::candlesticksToBeAnalysed.cend() - QScalarThread::VolatilityCandlesticks, QScalarThread::VolatilityCandlesticks);
+		QFeedingThread::extendToday(frame.sessionSize, frame.session);
+		
+		QFeedingThread::searchAll([&](HexSearchBuffer& buffer)
+		{
+			QScalarThread::dataCollection.locateGraduates(buffer, QScalarThread::candlesticksToBeAnalysed.cend() - numberOfElementaryCandlesticks, QScalarThread::timeUnit, QFeedingThread::feedingTimeUnit, QScalarThread::numberOfCandlesticks, QScalarThread::threshold, now, QScalarThread::nemesis, true);
+			QScalarThread::dataCollection.quickStudy(buffer, QScalarThread::stopLoss);
+		});
+		
+		if (QScalarThread::results.token.isCancelled())
+			break;
+		
+		const auto report = QScalarThread::dataCollection.scanReport(QScalarThread::results, QScalarThread::takeProfit);
+		searchStatistics.record(QFeedingThread::clock.nsecsElapsed() - start);
+		QFeedingThread::publish(report, frame, now, volatility);
+	}
+}
+
+void QFeedingThread::runIngest(void)
+{
+	const auto path = "feed/" + QScalarThread::directory;
+	std::unique_ptr<HexCandleSource> candleSource;
+	
+	if (QFeedingThread::source == SourceEnum::File)
+		candleSource = std::make_unique<HexFileSource>(QFile::exists(path + ".bin") ? path + ".bin" : path + ".txt");
+	else
+		candleSource = std::make_unique<HexSocketSource>("ScalarStudy." + QScalarThread::directory);
+	
+	if (candleSource->open())
+	{
+		const auto refTime = QTime(15, 30, 0);
+		const auto numberOfElementaryCandlesticks = QScalarThread::timeUnit*QScalarThread::numberOfCandlesticks/QFeedingThread::feedingTimeUnit;
+		const auto numberOfRecentCandlesticks = std::max(numberOfElementaryCandlesticks, QScalarThread::VolatilityCandlesticks);
+		auto& captureStatistics = QFeedingThread::statistics[static_cast<quint32>(StageEnum::Capture)];
+		auto& searchStatistics = QFeedingThread::statistics[static_cast<quint32>(StageEnum::Search)];
+		
+		std::vector<HexCandlestick<qreal>> sourceCandlesticks;
+		sourceCandlesticks.reserve(23'400u);
+		auto numberOfRestarts = candleSource->restarts();
+		
+		while (QFeedingThread::stagesRunning.load(std::memory_order_acquire))
+		{
+			const auto somethingNew = candleSource->read(sourceCandlesticks, 1);
 			
-			if (result == 2u)
+			// A shrunk file or a new connection starts the session over, from the first candlestick.
+			if (candleSource->restarts() != numberOfRestarts)
 			{
-				const auto updateFile = new HexUpdateFile(QScalarThread::candlesticksToBeAnalysed, now,
-										QScalarThread::timeUnit, QFeedingThread::feedingTimeUnit, QScalarThread::numberOfCandlesticks,
-										QScalarThread::numberOfCandidates, QScalarThread::threshold,
-										QScalarThread::takeProfit, QScalarThread::stopLoss,
-										QScalarThread::bestOverGraduates, QScalarThread::nemesis);
-				
-				QFeedingThread::triggerTableUpdate(updateFile);
-				QFeedingThread::latestColorLine = secsFromRef;
-				QFeedingThread::bipTone.play();
+				numberOfRestarts = candleSource->restarts();
+				QFeedingThread::numberOfSessionCandlesticks = 0u;
+				++QFeedingThread::numberOfSessions;
 			}
-			else if (result != 0u and QFeedingThread::latestColorLine + 10 < secsFromRef)
+			
+			if (not somethingNew)
+				continue;
+			
+			const auto start = QFeedingThread::clock.nsecsElapsed();
+			
+			if (sourceCandlesticks.size() < numberOfRecentCandlesticks)
+				continue;
+			
+			auto finalCandlesticks = HexKernelSwitch::Dispatch(QScalarThread::numberOfCandlesticks, [&](auto kernel)
 			{
-				QFeedingThread::latestColorLine = secsFromRef;
-				QFeedingThread::colorTone.play();
-			}
+				return decltype(kernel)::ExtractCandlesticks(sourceCandlesticks.cend() - numberOfElementaryCandlesticks, QScalarThread::timeUnit/QFeedingThread::feedingTimeUnit, QScalarThread::numberOfCandlesticks);
+			});
+			
+			const auto somethingChanged = QFeedingThread::Compare(finalCandlesticks, QFeedingThread::formattedCandlesticks);
+			captureStatistics.record(QFeedingThread::clock.nsecsElapsed() - start);
+			
+			if (not somethingChanged)
+				continue;
+			
+			QFeedingThread::formattedCandlesticks.swap(finalCandlesticks);
+			QFeedingThread::latestChange.store(start, std::memory_order_relaxed);
+			QFeedingThread::recordSession(sourceCandlesticks, static_cast<quint32>(sourceCandlesticks.size()));
+			
+			auto& frame = QFeedingThread::candleQueue.next();
+			frame.candlesticks.assign(sourceCandlesticks.cend() - numberOfRecentCandlesticks, sourceCandlesticks.cend());
+			frame.gap = QFeedingThread::currentGap;
+			frame.secsFromRef = refTime.secsTo(QTime::currentTime());
+			frame.timestamp = start;
+			frame.sessionSize = QFeedingThread::numberOfSessionCandlesticks;
+			frame.session = QFeedingThread::numberOfSessions;
+			QFeedingThread::journal.writeFrame(frame.timestamp, frame.secsFromRef, frame.gap, frame.candlesticks);
+			
+			if (QFeedingThread::candleQueue.push())
+				searchStatistics.drop();
 		}
-		else
-			QThread::msleep(50);
 	}
+	
+	candleSource->close();
+	QFeedingThread::sourceExhausted.store(true, std::memory_order_release);
+}
+
+void QFeedingThread::runParse(void)
+{
+	auto& parseStatistics = QFeedingThread::statistics[static_cast<quint32>(StageEnum::Parse)];
+	auto& searchStatistics = QFeedingThread::statistics[static_cast<quint32>(StageEnum::Search)];
+	
+	while (QFeedingThread::stagesRunning.load(std::memory_order_acquire))
+	{
+		if (not QFeedingThread::imageQueue.pop())
+		{
+			QThread::msleep(1);
+			continue;
+		}
+		
+		const auto start = QFeedingThread::clock.nsecsElapsed();
+		const auto& image = QFeedingThread::imageQueue.current();
+		auto& frame = QFeedingThread::candleQueue.next();
+		const auto somethingNew = QFeedingThread::updateCandlesticks(image, frame.candlesticks);
+		
+		parseStatistics.record(QFeedingThread::clock.nsecsElapsed() - start);
+		
+		if (somethingNew)
+		{
+			QFeedingThread::latestChange.store(image.timestamp, std::memory_order_relaxed);
+			QFeedingThread::scheduler.record(image.interval);
+			
+			frame.gap = QFeedingThread::currentGap;
+			frame.secsFromRef = image.secsFromRef;
+			frame.timestamp = image.timestamp;
+			QFeedingThread::journal.writeFrame(frame.timestamp, frame.secsFromRef, frame.gap, frame.candlesticks);
+			
+			if (QFeedingThread::candleQueue.push())
+				searchStatistics.drop();
+		}
+	}
+}
+
+void QFeedingThread::runReplay(void)
+{
+	QFeedingThread::replayPath.endsWith(".bin") ? QFeedingThread::replayJournal() : QFeedingThread::replayDay();
+	
+	while (QFeedingThread::candleQueue.pending() and QFeedingThread::stagesRunning.load(std::memory_order_acquire))
+		QThread::yieldCurrentThread();
+	
+	QFeedingThread::sourceExhausted.store(true, std::memory_order_release);
+}
+
+void QFeedingThread::searchAll(const std::function<void(HexSearchBuffer&)>& search)
+{
+	if (QFeedingThread::companionResults.empty())
+		return QScalarThread::workers.run(QoSEnum::Live, [&](){ search(QScalarThread::results); });
+	
+	std::vector<std::function<void(void)>> tasks = { [&](){ search(QScalarThread::results); } };
+	
+	for (auto& buffer : QFeedingThread::companionResults)
+		tasks.push_back([&search, &buffer](){ search(buffer); });
+	
+	QScalarThread::workers.run(QoSEnum::Live, tasks);
 }
 
 void QFeedingThread::setUp(const HexCheckFile& report, qreal scaleGap, bool best, bool nms)
@@ -252,6 +803,20 @@ void QFeedingThread::setUp(const HexCheckFile& report, qreal scaleGap, bool best
 	QFeedingThread::currentGap = scaleGap;
 	QFeedingThread::feedingTimeUnit = report.feedingTimeUnit;
 	QFeedingThread::latestColorLine = 0;
+	QFeedingThread::scheduler.setUp(report.latencyBudget, report.feedingTimeUnit);
+	QFeedingThread::source = report.source;
+	QFeedingThread::replayPath = report.replayPath;
+	QFeedingThread::replaySpeed = report.replaySpeed;
+	QFeedingThread::companions = report.companions;
+	
+	while (QFeedingThread::companionResults.size() > static_cast<std::size_t>(QFeedingThread::companions.size()))
+		QFeedingThread::companionResults.pop_back();
+	
+	while (QFeedingThread::companionResults.size() < static_cast<std::size_t>(QFeedingThread::companions.size()))
+		QFeedingThread::companionResults.emplace_back().incremental = true;
+	
+	for (auto& buffer : QFeedingThread::companionResults)
+		buffer.token.reset();
 }
 
 void QFeedingThread::setVolume(qreal volume)
@@ -260,106 +825,134 @@ void QFeedingThread::setVolume(qreal volume)
 	QFeedingThread::colorTone.setVolume(volume);
 }
 
-bool QFeedingThread::updateCandlesticks(void)
+const HexStageStatistics& QFeedingThread::stageStatistics(StageEnum stage) const
 {
-	const auto img = QGuiApplication::primaryScreen()->grabWindow(0, QFeedingThread::ChartLeftValue, QFeedingThread::ChartTopValue, QFeedingThread::ChartWidth, QFeedingThread::ChartHeight).toImage();
-	auto it = reinterpret_cast<const quint32*>(img.constScanLine(0));
-	auto realWidth = 0;
+	return QFeedingThread::statistics[static_cast<quint32>(stage)];
+}
+
+void QFeedingThread::stop(void)
+{
+	QScalarThread::stop();
 	
-	while (*it != QFeedingThread::GrayColor and realWidth < QFeedingThread::ChartWidth)
+	for (auto& buffer : QFeedingThread::companionResults)
+		buffer.token.cancel();
+}
+
+void QFeedingThread::startStages(void)
+{
+	QFeedingThread::imageQueue.reset();
+	QFeedingThread::candleQueue.reset();
+	
+	for (auto& stats : QFeedingThread::statistics)
+		stats.reset();
+	
+	QFeedingThread::latestChange.store(-1, std::memory_order_relaxed);
+	QFeedingThread::sourceExhausted.store(false, std::memory_order_relaxed);
+	QFeedingThread::replayLatencies.clear();
+	QFeedingThread::alertTimeline.clear();
+	QFeedingThread::stripLeft.store(-1, std::memory_order_relaxed);
+	QFeedingThread::chartWidth = 0;
+	QFeedingThread::numberOfSessionCandlesticks = 0u;
+	QFeedingThread::numberOfSessions = 0u;
+	QFeedingThread::todaySession = 0u;
+	QFeedingThread::today = std::make_shared<HexDayHistory>(QDate::currentDate().toString("ddd dd MMM"), QScalarThread::timeUnit, QScalarThread::numberOfCandlesticks);
+	
+	const auto elementary = (QFeedingThread::feedingTimeUnit == 1u and QFeedingThread::source != SourceEnum::Screen and not QFeedingThread::replayPath.endsWith(".bin"));
+	QScalarThread::results.today = (elementary ? QFeedingThread::today : nullptr);
+	QFeedingThread::stagesRunning.store(true, std::memory_order_release);
+	QFeedingThread::clock.start();
+	
+	if (QFeedingThread::source != SourceEnum::Replay and QDir().mkpath("journal/"))
 	{
-		++it;
-		++realWidth;
+		const auto journalPath = "journal/" + QScalarThread::directory + '_' + QDateTime::currentDateTime().toString("yyyyMMdd_hhmmss") + ".bin";
+		QFeedingThread::journal.create(journalPath, QScalarThread::timeUnit, QScalarThread::numberOfCandlesticks, QFeedingThread::feedingTimeUnit, QFeedingThread::currentGap);
+	}
+	
+	if (QFeedingThread::source == SourceEnum::Replay)
+	{
+		QFeedingThread::captureStage = QThread::create([this](){ QFeedingThread::runReplay(); });
+		QFeedingThread::captureStage->start();
+		return;
+	}
+	
+	if (QFeedingThread::source != SourceEnum::Screen)
+	{
+		QFeedingThread::captureStage = QThread::create([this](){ QFeedingThread::runIngest(); });
+		QFeedingThread::captureStage->start();
+		return;
 	}
 	
-	const auto realImage = img.copy(0, 0, realWidth + 2, QFeedingThread::ChartHeight).transformed(QTransform().rotate(90.f));
-	auto pixelIt = reinterpret_cast<const quint32*>(realImage.constScanLine(realWidth + 1));
+	QFeedingThread::captureStage = QThread::create([this](){ QFeedingThread::runCapture(); });
+	QFeedingThread::parseStage = QThread::create([this](){ QFeedingThread::runParse(); });
+	QFeedingThread::captureStage->start();
+	QFeedingThread::parseStage->start();
+}
+
+void QFeedingThread::stopStages(void)
+{
+	if (QFeedingThread::captureStage == nullptr)
+		return;
 	
-	auto numberOfGrayBars = 0u;
-	auto pMin = 0;
-	auto pMax = 0;
+	QFeedingThread::stagesRunning.store(false, std::memory_order_release);
 	
-	for (auto pixelCount = 0; pixelCount < QFeedingThread::ChartHeight; ++pixelCount)
+	for (const auto stage : { QFeedingThread::captureStage, QFeedingThread::parseStage })
 	{
-		if (*pixelIt == QFeedingThread::GrayColor)
-		{
-			if (numberOfGrayBars == 0u)
-				pMin = pixelCount;
-			
-			pMax = pixelCount;
-			++numberOfGrayBars;
-		}
+		if (stage != nullptr)
+			stage->wait();
 		
-		++pixelIt;
+		delete stage;
 	}
 	
-	if (numberOfGrayBars < 2u)
+	QFeedingThread::captureStage = nullptr;
+	QFeedingThread::parseStage = nullptr;
+	QFeedingThread::journal.close();
+	
+	QFeedingThread::report();
+}
+
+bool QFeedingThread::updateCandlesticks(const HexImageFrame& frame, std::vector<HexCandlestick<qreal>>& pixelCandlesticks)
+{
+	const auto parsed = (frame.full ? QFeedingThread::parseChart(frame.image) : QFeedingThread::parseStrip(frame.image, frame.left));
+	
+	if (not parsed)
+	{
+		QFeedingThread::stripLeft.store(-1, std::memory_order_release);
 		return false;
-	else if (QFeedingThread::numberOfBars == 0u)
-		QFeedingThread::numberOfBars = numberOfGrayBars;
+	}
 	
-	QFeedingThread::updateGap(numberOfGrayBars);
-	QFeedingThread::numberOfBars = numberOfGrayBars;
+	QFeedingThread::stripLeft.store(QFeedingThread::chartWidth >= QFeedingThread::StripWidth ? QFeedingThread::chartWidth - QFeedingThread::StripWidth : -1, std::memory_order_release);
 	
-	const auto coeff = QFeedingThread::currentGap*static_cast<qreal>(numberOfGrayBars - 1u)/static_cast<qreal>(pMax - pMin);
+	const auto coeff = QFeedingThread::currentGap*static_cast<qreal>(QFeedingThread::numberOfBars - 1u)/static_cast<qreal>(QFeedingThread::grayBottom - QFeedingThread::grayTop);
 	const auto numberOfElementaryCandlesticks = QScalarThread::timeUnit*QScalarThread::numberOfCandlesticks/QFeedingThread::feedingTimeUnit;
 	
-	std::vector<HexCandlestick<qreal>> pixelCandlesticks;
+	pixelCandlesticks.clear();
 	pixelCandlesticks.reserve(500u);
 	
-	for (auto lineCount = 0; lineCount < realWidth; ++lineCount)
+	for (auto x = 0; x < QFeedingThread::chartWidth; ++x)
 	{
-		auto pxIt = reinterpret_cast<const quint32*>(realImage.constScanLine(lineCount));
-		auto min = -1000.;
-		auto max = -1000.;
+		if (QFeedingThread::blueTops[x] < 0)
+			continue;
 		
-		for (auto pixelCount = 0; pixelCount < QFeedingThread::ChartHeight; ++pixelCount)
-		{
-			switch (*pxIt)
-			{
-				case QFeedingThread::BlueColor:
-				{
-					max = coeff*static_cast<qreal>(pixelCount - pMin);
-					break;
-				}
-				
-				case QFeedingThread::RedColor:
-				{
-					if (min == -1000.)
-						min = coeff*static_cast<qreal>(pixelCount - pMin);
-					
-					break;
-				}
-				
-				default:
-					break;
-			}
-			
-			++pxIt;
-		}
+		auto max = coeff*static_cast<qreal>(QFeedingThread::grayBottom - QFeedingThread::blueTops[x]);
+		auto min = (QFeedingThread::redBottoms[x] < 0 ? max : coeff*static_cast<qreal>(QFeedingThread::grayBottom - QFeedingThread::redBottoms[x]));
 		
-		if (max != -1000.)
-		{
-			if (min == -1000.)
-				min = max;
-			
-			QFeedingThread::RoundToClosestQuarter(min);
-			QFeedingThread::RoundToClosestQuarter(max);
-			pixelCandlesticks.emplace_back(min, max);
-		}
+		QFeedingThread::RoundToClosestQuarter(min);
+		QFeedingThread::RoundToClosestQuarter(max);
+		pixelCandlesticks.emplace_back(min, max);
 	}
 	
 	if (pixelCandlesticks.size() < numberOfElementaryCandlesticks)
 		return false;
 	
-	auto finalCandlesticks = QFeedingThread::ExtractCandlesticks(pixelCandlesticks.cend() - numberOfElementaryCandlesticks, QScalarThread::timeUnit/QFeedingThread::feedingTimeUnit, QScalarThread::numberOfCandlesticks);
+	auto finalCandlesticks = HexKernelSwitch::Dispatch(QScalarThread::numberOfCandlesticks, [&](auto kernel)
+	{
+		return decltype(kernel)::ExtractCandlesticks(pixelCandlesticks.cend() - numberOfElementaryCandlesticks, QScalarThread::timeUnit/QFeedingThread::feedingTimeUnit, QScalarThread::numberOfCandlesticks);
+	});
+	
 	const auto somethingChanged = QFeedingThread::Compare(finalCandlesticks, QFeedingThread::formattedCandlesticks);
 	
 	if (somethingChanged)
-	{
-		QScalarThread::candlesticksToBeAnalysed.swap(pixelCandlesticks);
 		QFeedingThread::formattedCandlesticks.swap(finalCandlesticks);
-	}
 	
 	return somethingChanged;
 }
@@ -377,6 +970,7 @@ void QFeedingThread::updateGap(quint32 numberOfGrayBars)
 			
 			++it;
 			QFeedingThread::currentGap = *it;
+			QFeedingThread::journal.writeGap(QFeedingThread::clock.nsecsElapsed(), *it);
 			QFeedingThread::triggerGapUpdate(*it);
 			std::cout << " >> Gap increased to " << QFeedingThread::currentGap << '.' << std::endl;
 		}
@@ -394,6 +988,7 @@ void QFeedingThread::updateGap(quint32 numberOfGrayBars)
 			
 			--it;
 			QFeedingThread::currentGap = *it;
+			QFeedingThread::journal.writeGap(QFeedingThread::clock.nsecsElapsed(), *it);
 			QFeedingThread::triggerGapUpdate(*it);
 			std::cout << " >> Gap decreased to " << QFeedingThread::currentGap << '.' << std::endl;
 		}
@@ -402,9 +997,10 @@ void QFeedingThread::updateGap(quint32 numberOfGrayBars)
 	}
 }
 
-quint32 QFeedingThread::updateTerminal(const HexScanReport& report, quint32 realTime, qreal volatility) const
+quint32 QFeedingThread::updateTerminal(const HexScanReport& report, quint32 realTime, qreal gap, qreal volatility, const QString& instrument)
 {
-	HexTerminalFile* info = new HexTerminalFile(realTime, QFeedingThread::currentGap, volatility);
+	HexTerminalFile info(realTime, gap, volatility);
+	info.setInstrument(instrument);
 	return QScalarThread::generalTerminalUpdate(report, info);
 }
 
@@ -14,7 +14,11 @@ class QScalarModel : public QAbstractTableModel
 	
 	private:
 	
-		const std::vector<HexFullFile>&		precedents;
+		static constexpr qint32			NumberOfRows = 6;
+		
+		inline static bool			Same(const HexFullFile&, const HexFullFile&);
+		
+		std::vector<HexFullFile>		precedents;
 		
 		inline QVariant				horizontalHeader(qint32) const;
 		inline QVariant				retrieveBackground(const QModelIndex&) const;
@@ -23,15 +27,18 @@ class QScalarModel : public QAbstractTableModel
 	
 	public:
 	
-		inline					QScalarModel(const std::vector<HexFullFile>&);
 		inline qint32				columnCount(const QModelIndex&) const override;
 		inline QVariant				data(const QModelIndex&, qint32) const override;
 		inline QVariant				headerData(qint32, Qt::Orientation, qint32) const override;
+		inline const HexFullFile&		precedent(qint32) const;
 		inline qint32				rowCount(const QModelIndex&) const override;
+		inline void				update(const std::vector<HexFullFile>&);
 };
 
-QScalarModel::QScalarModel(const std::vector<HexFullFile>& foo) : precedents(foo)
+bool QScalarModel::Same(const HexFullFile& a, const HexFullFile& b)
 {
+	return (a.day == b.day and a.sampleTimeSpot == b.sampleTimeSpot and a.tradeTimeSpot == b.tradeTimeSpot and a.timeUnit == b.timeUnit
+		and a.similarity == b.similarity and a.factor == b.factor and a.bestBuyProfit == b.bestBuyProfit and a.bestSellProfit == b.bestSellProfit and a.foo == b.foo);
 }
 
 qint32 QScalarModel::columnCount(const QModelIndex&) const
@@ -80,6 +87,11 @@ QVariant QScalarModel::horizontalHeader(qint32 column) const
 	return QString::number(column + 1);
 }
 
+const HexFullFile& QScalarModel::precedent(qint32 column) const
+{
+	return QScalarModel::precedents[static_cast<quint32>(column)];
+}
+
 QVariant QScalarModel::retrieveBackground(const QModelIndex& index) const
 {
 	const auto column = index.column();
@@ -143,7 +155,54 @@ QVariant QScalarModel::retrieveData(const QModelIndex& index) const
 
 qint32 QScalarModel::rowCount(const QModelIndex&) const
 {
-	return (QScalarModel::precedents.empty() ? 0 : 6);
+	return (QScalarModel::precedents.empty() ? 0 : QScalarModel::NumberOfRows);
+}
+
+void QScalarModel::update(const std::vector<HexFullFile>& results)
+{
+	if (QScalarModel::precedents.empty() != results.empty())
+	{
+		QAbstractItemModel::beginResetModel();
+		QScalarModel::precedents = results;
+		QAbstractItemModel::endResetModel();
+		return;
+	}
+	
+	const auto oldSize = static_cast<qint32>(QScalarModel::precedents.size());
+	const auto newSize = static_cast<qint32>(results.size());
+	const auto common = std::min(oldSize, newSize);
+	
+	auto firstChanged = common;
+	auto lastChanged = -1;
+	
+	for (auto i = 0; i < common; ++i)
+	{
+		if (QScalarModel::Same(QScalarModel::precedents[static_cast<quint32>(i)], results[static_cast<quint32>(i)]))
+			continue;
+		
+		firstChanged = std::min(firstChanged, i);
+		lastChanged = i;
+	}
+	
+	if (newSize < oldSize)
+	{
+		QAbstractItemModel::beginRemoveColumns(QModelIndex(), newSize, oldSize - 1);
+		QScalarModel::precedents.erase(QScalarModel::precedents.cbegin() + newSize, QScalarModel::precedents.cend());
+		QAbstractItemModel::endRemoveColumns();
+	}
+	
+	if (lastChanged >= 0)
+	{
+		std::copy(results.cbegin() + firstChanged, results.cbegin() + lastChanged + 1, QScalarModel::precedents.begin() + firstChanged);
+		QAbstractItemModel::dataChanged(QAbstractItemModel::index(0, firstChanged), QAbstractItemModel::index(QScalarModel::NumberOfRows - 1, lastChanged));
+	}
+	
+	if (newSize > oldSize)
+	{
+		QAbstractItemModel::beginInsertColumns(QModelIndex(), oldSize, newSize - 1);
+		QScalarModel::precedents.insert(QScalarModel::precedents.cend(), results.cbegin() + oldSize, results.cend());
+		QAbstractItemModel::endInsertColumns();
+	}
 }
 
 QVariant QScalarModel::verticalHeader(qint32 row) const
@@ -158,7 +217,7 @@ QVariant QScalarModel::verticalHeader(qint32 row) const
 		
 		case 2:
 			return QString("Mark");
-
+		
 		case 3:
 			return QString("Scale");
 		
@@ -10,23 +10,28 @@ using std::string_literals::operator""s;
 
 // Personal Libraries
 #include "HexDataCenter.hpp"
+#include "HexRowQueue.hpp"
+#include "HexWorkerPool.hpp"
 
 class QScalarThread : public QThread
 {
 	Q_OBJECT
 	
 	private:
-		
-		inline static QString						Number(qreal);
+	
+		static constexpr quint32					TerminalCapacity = 16'384u;
 	
 	protected:
-		
+	
 		static constexpr quint32					VolatilityCandlesticks = 10u;
 		
 		inline static qreal						AssessVolatility(std::vector<HexCandlestick<qreal>>::const_iterator, quint32);
 		
 		std::vector<HexCandlestick<qreal>>				candlesticksToBeAnalysed;
 		HexDataCenter&							dataCollection;
+		HexWorkerPool&							workers;
+		HexRowQueue<HexTerminalFile>					terminalRows;
+		HexSearchBuffer							results;
 		QString								directory;
 		
 		quint32								numberOfDays;
@@ -44,22 +49,18 @@ class QScalarThread : public QThread
 		
 		bool								bestOverGraduates;
 		bool								nemesis;
-		bool								shouldContinue;
 		
 		inline void							generalSetUp(const HexCheckFile&, bool, bool);
-		inline quint32							generalTerminalUpdate(const HexScanReport&, HexTerminalFile*) const;
+		inline quint32							generalTerminalUpdate(const HexScanReport&, HexTerminalFile&);
 	
 	public:
 	
-		inline								QScalarThread(HexDataCenter&);
-		inline void							stop(void);
-	
-	signals:
-	
-		void								triggerTerminalUpdate(HexTerminalFile*);
+		inline								QScalarThread(HexDataCenter&, HexWorkerPool&);
+		inline virtual void						stop(void);
+		inline HexRowQueue<HexTerminalFile>&				terminalQueue(void);
 };
 
-QScalarThread::QScalarThread(HexDataCenter& foo) : dataCollection(foo)
+QScalarThread::QScalarThread(HexDataCenter& foo, HexWorkerPool& pool) : dataCollection(foo), workers(pool), terminalRows(QScalarThread::TerminalCapacity)
 {
 	QScalarThread::candlesticksToBeAnalysed.reserve(400u);
 }
@@ -107,31 +108,31 @@ void QScalarThread::generalSetUp(const HexCheckFile& report, bool best, bool nms
 	
 	QScalarThread::bestOverGraduates = best;
 	QScalarThread::nemesis = nms;
-	QScalarThread::shouldContinue = true;
+	QScalarThread::results.token.reset();
 }
 
-quint32 QScalarThread::generalTerminalUpdate(const HexScanReport& report, HexTerminalFile* info) const
+quint32 QScalarThread::generalTerminalUpdate(const HexScanReport& report, HexTerminalFile& info)
 {
-	info->worstSimilarity = static_cast<qreal>(report.worstSimilarity*100.);
-	info->numberOfSamples = report.numberOfSamples;
+	info.worstSimilarity = static_cast<qreal>(report.worstSimilarity*100.);
+	info.numberOfSamples = report.numberOfSamples;
 	
 	if (report.numberOfSamples >= 10u)
 	{
 		const auto b70 = report.bestBuys[report.numberOfSamples*3u/10u];
 		const auto s70 = report.bestSells[report.numberOfSamples*3u/10u];
 		
-		info->buy70 = static_cast<qreal>(b70);
-		info->buy80 = static_cast<qreal>(report.bestBuys[report.numberOfSamples/5u]);
-		info->buy90 = static_cast<qreal>(report.bestBuys[report.numberOfSamples/10u]);
+		info.buy70 = static_cast<qreal>(b70);
+		info.buy80 = static_cast<qreal>(report.bestBuys[report.numberOfSamples/5u]);
+		info.buy90 = static_cast<qreal>(report.bestBuys[report.numberOfSamples/10u]);
 		
-		info->sell70 = static_cast<qreal>(s70);
-		info->sell80 = static_cast<qreal>(report.bestSells[report.numberOfSamples/5u]);
-		info->sell90 = static_cast<qreal>(report.bestSells[report.numberOfSamples/10u]);
+		info.sell70 = static_cast<qreal>(s70);
+		info.sell80 = static_cast<qreal>(report.bestSells[report.numberOfSamples/5u]);
+		info.sell90 = static_cast<qreal>(report.bestSells[report.numberOfSamples/10u]);
 		
 		if (report.bWin > report.sWin)
-			info->ratio = 1'000u + (report.bWin + report.eWin)*100u/report.numberOfSamples;
+			info.ratio = 1'000u + (report.bWin + report.eWin)*100u/report.numberOfSamples;
 		else
-			info->ratio = (report.bWin < report.sWin ? 3'000u : 2'000u) + (report.sWin + report.eWin)*100u/report.numberOfSamples;
+			info.ratio = (report.bWin < report.sWin ? 3'000u : 2'000u) + (report.sWin + report.eWin)*100u/report.numberOfSamples;
 		
 		if (report.worstSimilarity >= QScalarThread::threshold and report.numberOfSamples >= QScalarThread::numberOfCandidates)
 		{
@@ -139,57 +140,36 @@ quint32 QScalarThread::generalTerminalUpdate(const HexScanReport& report, HexTer
 			
 			if (report.bestBuys[index] >= QScalarThread::takeProfit or report.bestSells[index] >= QScalarThread::takeProfit)
 			{
-				const_cast<QScalarThread*>(this)->triggerTerminalUpdate(info);
+				QScalarThread::terminalRows.push(info);
 				return 2u;
 			}
 			
 			if (b70 >= QScalarThread::takeProfit or s70 >= QScalarThread::takeProfit)
 			{
-				const_cast<QScalarThread*>(this)->triggerTerminalUpdate(info);
+				QScalarThread::terminalRows.push(info);
 				return 1u;
 			}
 		}
 	}
 	else if (report.numberOfSamples != 0u)
 	{
-		auto count = 0u;
-		
-		for (const auto& b : report.bestBuys)
-		{
-			info->buy += (b != 0. ? QScalarThread::Number(b).left(4u) : QString("xxxx")) + "  ";
-			++count;
-			
-			if (count == 8u)
-				break;
-		}
-		
-		info->buy.chop(2u);
-		count = 0u;
-		
-		for (const auto& s : report.bestSells)
-		{
-			info->sell += (s != 0. ? QScalarThread::Number(s).left(4u) : QString("xxxx")) + "  ";
-			++count;
-			
-			if (count == 8u)
-				break;
-		}
-		
-		info->sell.chop(2u);
+		info.numberOfBests = static_cast<quint32>(std::min(report.bestBuys.size(), info.buys.size()));
+		std::copy_n(report.bestBuys.cbegin(), info.numberOfBests, info.buys.begin());
+		std::copy_n(report.bestSells.cbegin(), info.numberOfBests, info.sells.begin());
 	}
 	
-	const_cast<QScalarThread*>(this)->triggerTerminalUpdate(info);
+	QScalarThread::terminalRows.push(info);
 	return 0u;
 }
 
-QString QScalarThread::Number(qreal nb)
+void QScalarThread::stop(void)
 {
-	return QString::number(static_cast<double>(nb), 'f', 6);
+	QScalarThread::results.token.cancel();
 }
 
-void QScalarThread::stop(void)
+HexRowQueue<HexTerminalFile>& QScalarThread::terminalQueue(void)
 {
-	QScalarThread::shouldContinue = false;
+	return QScalarThread::terminalRows;
 }
 
 #endif 
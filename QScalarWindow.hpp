@@ -5,9 +5,7 @@
 #include <QButtonGroup>
 #include <QCheckBox>
 #include <QComboBox>
-#include <QGraphicsRectItem>
-#include <QGraphicsScene>
-#include <QGraphicsView>
+#include <QFileDialog>
 #include <QGridLayout>
 #include <QHBoxLayout>
 #include <QLabel>
@@ -17,14 +15,18 @@
 #include <QSlider>
 #include <QTableView>
 #include <QTextEdit>
+#include <QTimer>
 #include <QValidator>
 #include <QVBoxLayout>
 
 // Standard Libraries
 #include <array>
+#include <future>
 
 // Personal Libraries
+#include "HexPreviewCache.hpp"
 #include "QAnalysingThread.hpp"
+#include "QCandlestickChart.hpp"
 #include "QFeedingThread.hpp"
 #include "QScalarModel.hpp"
 #include "QTerminalWindow.hpp"
@@ -35,13 +37,28 @@ class QScalarWindow : public QMainWindow
 	
 	private:
 	
-		inline static std::vector<HexCandlestick<qreal>>				ExtractCandlesticks(std::vector<HexCandlestick<qreal>>::const_iterator, quint32, quint32);
-	
+		static constexpr qint32								PreloadDelay = 500;
+		
 		std::array<QLineEdit*, 8u>							lowEdits;
 		std::array<QLineEdit*, 8u>							highEdits;
 		
 		QTerminalWindow* const								outputWindow = new QTerminalWindow(this);
+		HexWorkerPool									workers;
 		HexDataCenter									dataCollection;
+		HexSearchBuffer									results;
+		HexSearchBuffer									staging;
+		HexPreviewCache									previews;
+		
+		std::vector<QThread*>								preloads;
+		std::shared_ptr<HexCancelToken>							preloadToken;
+		HexCheckFile									preloadReport;
+		QThread*									preparation = nullptr;
+		std::function<void(void)>							preparedSearch;
+		bool										preparing = false;
+		std::vector<HexCandlestick<qreal>>						searchedQuery;
+		std::future<void>								searching;
+		std::function<void(void)>							finishedSearch;
+		std::function<void(void)>							queuedSearch;
 		
 		QLineEdit* const								buySuccessRateEdit = new QLineEdit(this);
 		QLineEdit* const								buyAverageGainEdit = new QLineEdit(this);
@@ -60,6 +77,7 @@ class QScalarWindow : public QMainWindow
 		QCheckBox* const								nemesisCheckBox = new QCheckBox("Nemesis", this);
 		
 		QComboBox* const								choiceBox = new QComboBox(this);
+		QComboBox* const								sourceBox = new QComboBox(this);
 		
 		QLineEdit* const								numberOfDaysEdit = new QLineEdit(this);
 		QLineEdit* const								scopeEdit = new QLineEdit(this);
@@ -71,11 +89,15 @@ class QScalarWindow : public QMainWindow
 		QLineEdit* const								bestEdit = new QLineEdit(this);
 		QLineEdit* const								thresholdEdit = new QLineEdit(this);
 		QLineEdit* const								balanceEdit = new QLineEdit(this);
+		QLineEdit* const								crossEdit = new QLineEdit(this);
 		QLineEdit* const								gapEdit = new QLineEdit(this);
+		QLineEdit* const								latencyEdit = new QLineEdit(this);
+		QLineEdit* const								speedEdit = new QLineEdit(this);
 		QLineEdit* const								takeProfitEdit = new QLineEdit(this);
 		QLineEdit* const								stopLossEdit = new QLineEdit(this);
 		
 		QLabel* const									timeUpdateLabel = new QLabel(this);
+		QTimer* const									preloadTimer = new QTimer(this);
 		
 		QTableView* const								positiveCloneTable = new QTableView(this);
 		QScalarModel									positiveModel;
@@ -83,14 +105,9 @@ class QScalarWindow : public QMainWindow
 		QTableView* const								negativeCloneTable = new QTableView(this);
 		QScalarModel									negativeModel;
 		
-		QGraphicsView* const								feedingView = new QGraphicsView(this);
-		QGraphicsScene* const								feedingScene = new QGraphicsScene(this);
-		
-		QGraphicsView* const								positiveView = new QGraphicsView(this);
-		QGraphicsScene* const								positiveScene = new QGraphicsScene(this);
-		
-		QGraphicsView* const								negativeView = new QGraphicsView(this);
-		QGraphicsScene* const								negativeScene = new QGraphicsScene(this);
+		QCandlestickChart* const							feedingChart = new QCandlestickChart(this);
+		QCandlestickChart* const							positiveChart = new QCandlestickChart(this);
+		QCandlestickChart* const							negativeChart = new QCandlestickChart(this);
 		
 		std::vector<HexCandlestick<qreal>>						candlesticksToBeAnalysed;
 		QFeedingThread									feedThread;
@@ -100,10 +117,11 @@ class QScalarWindow : public QMainWindow
 		qint32										currentNegativeColumn;
 		
 		inline HexCheckFile								check(MissionEnum);
+		inline void									prepare(const HexCheckFile&, std::vector<HexCandlestick<qreal>>&&, qreal);
 		inline void									recordAnalysis(void);
-		inline void									search(std::vector<HexCandlestick<qreal>>::const_iterator, quint32, quint32, quint32, quint32, qreal, qreal, qreal, qreal, bool, bool);
+		inline void									search(std::shared_ptr<const HexDataSnapshot>, quint32, std::vector<HexCandlestick<qreal>>&&, quint32, quint32, quint32, quint32, qreal, qreal, qreal, qreal, bool, bool);
 		inline void									toggleWidgets(bool);
-		inline void									updateCandlesticks(QGraphicsScene*, QGraphicsView*, const std::vector<HexCandlestick<qreal>>&, quint32, qreal) const;
+		inline bool									updateCoefficients(const HexCheckFile&);
 		inline void									updatePanel(const HexFullReport*) const;
 		inline void									updateTables(void);
 		inline void									updateViews(bool) const;
@@ -113,11 +131,14 @@ class QScalarWindow : public QMainWindow
 		inline void									analyse(void);
 		inline void									deleteCandlestick(void);
 		inline void									feed(void);
+		inline void									finishSearch(void);
 		inline void									locate(void);
+		inline void									preload(void);
 		inline void									reset(void);
 		inline void									scan(void);
 		inline void									showNegativeCandlesticks(const QModelIndex&);
 		inline void									showPositiveCandlesticks(const QModelIndex&);
+		inline void									startSearch(bool);
 		inline void									toggleFeed(void);
 		inline void									toggleScan(void);
 		inline void									triggerSearch(HexUpdateFile*);
@@ -131,14 +152,18 @@ class QScalarWindow : public QMainWindow
 	public:
 	
 		inline QScalarWindow(void);
+	
+	signals:
+	
+		void										triggerSearchStart(bool);
+		void										triggerSearchFinish(void);
 };
 
 QScalarWindow::QScalarWindow(void) :
 	QMainWindow(),
-	positiveModel(dataCollection.getPositivePrecedents()),
-	negativeModel(dataCollection.getNegativePrecedents()),
-	feedThread(dataCollection),
-	scanThread(dataCollection)
+	previews(results),
+	feedThread(dataCollection, workers),
+	scanThread(dataCollection, workers)
 {
 	const auto vLayout = new QVBoxLayout(new QWidget());
 	vLayout->setSpacing(0);
@@ -147,6 +172,11 @@ QScalarWindow::QScalarWindow(void) :
 	QMainWindow::setCentralWidget(vLayout->parentWidget());
 	QMainWindow::setWindowTitle("Scalar Study");
 	QScalarWindow::choiceBox->setMaximumWidth(70);
+	QScalarWindow::sourceBox->setMaximumWidth(70);
+	QScalarWindow::crossEdit->setMaximumWidth(70);
+	
+	for (const auto& str : { "Screen", "File", "Socket", "Replay" })
+		QScalarWindow::sourceBox->addItem(str);
 	
 	QDir dataDir("input/");
 	dataDir.setFilter(QDir::Dirs | QDir::NoDotAndDotDot);
@@ -213,9 +243,18 @@ QScalarWindow::QScalarWindow(void) :
 	const auto balanceLabel = new QLabel("Balance", this);
 	balanceLabel->setMaximumWidth(60);
 	
+	const auto crossLabel = new QLabel("Cross", this);
+	crossLabel->setMaximumWidth(40);
+	
 	const auto gapLabel = new QLabel("Gap", this);
 	gapLabel->setMaximumWidth(40);
 	
+	const auto latencyLabel = new QLabel("LB", this);
+	latencyLabel->setMaximumWidth(25);
+	
+	const auto speedLabel = new QLabel("Speed", this);
+	speedLabel->setMaximumWidth(40);
+	
 	QScalarWindow::numberOfDaysEdit->setValidator(intValidator);
 	QScalarWindow::scopeEdit->setValidator(intValidator);
 	
@@ -227,7 +266,10 @@ QScalarWindow::QScalarWindow(void) :
 	QScalarWindow::bestEdit->setValidator(intValidator);
 	QScalarWindow::thresholdEdit->setValidator(floatValidator);
 	QScalarWindow::balanceEdit->setValidator(floatValidator);
+	QScalarWindow::crossEdit->setValidator(new QRegularExpressionValidator(QRegularExpression("([A-Za-z0-9_]+,)*[A-Za-z0-9_]*"), this));
 	QScalarWindow::gapEdit->setValidator(floatValidator);
+	QScalarWindow::latencyEdit->setValidator(intValidator);
+	QScalarWindow::speedEdit->setValidator(intValidator);
 	
 	QScalarWindow::takeProfitEdit->setValidator(floatValidator);
 	QScalarWindow::stopLossEdit->setValidator(floatValidator);
@@ -242,7 +284,7 @@ QScalarWindow::QScalarWindow(void) :
 				QScalarWindow::timeSpotEdit, QScalarWindow::timeUnitEdit,
 				QScalarWindow::numberOfCandlesticksEdit, QScalarWindow::firstCoefficientEdit,
 				QScalarWindow::bestEdit, QScalarWindow::thresholdEdit,
-				QScalarWindow::balanceEdit, QScalarWindow::gapEdit,
+				QScalarWindow::balanceEdit, QScalarWindow::gapEdit, QScalarWindow::latencyEdit, QScalarWindow::speedEdit,
 				QScalarWindow::takeProfitEdit, QScalarWindow::stopLossEdit };
 	
 	for (const auto& e : eList)
@@ -252,9 +294,9 @@ QScalarWindow::QScalarWindow(void) :
 							timeSpotLabel, QScalarWindow::timeSpotEdit, timeUnitLabel, QScalarWindow::timeUnitEdit,
 							numberOfCandlesticksLabel, QScalarWindow::numberOfCandlesticksEdit,
 							firstCoefficientLabel, QScalarWindow::firstCoefficientEdit,
-							locateButton, analyseButton, QScalarWindow::scanButton, QScalarWindow::feedButton, resetButton,
+							locateButton, analyseButton, QScalarWindow::scanButton, QScalarWindow::feedButton, QScalarWindow::sourceBox, crossLabel, QScalarWindow::crossEdit, resetButton,
 							QScalarWindow::bestCheckBox, QScalarWindow::bestEdit, QScalarWindow::thresholdCheckBox, QScalarWindow::thresholdEdit,
-							balanceLabel, QScalarWindow::balanceEdit, gapLabel, QScalarWindow::gapEdit,
+							balanceLabel, QScalarWindow::balanceEdit, gapLabel, QScalarWindow::gapEdit, latencyLabel, QScalarWindow::latencyEdit, speedLabel, QScalarWindow::speedEdit,
 							takeProfitLabel, QScalarWindow::takeProfitEdit, stopLossLabel, QScalarWindow::stopLossEdit,
 							QScalarWindow::nemesisCheckBox, slider, QScalarWindow::timeUpdateLabel };
 	
@@ -274,24 +316,19 @@ QScalarWindow::QScalarWindow(void) :
 	const auto centralWidget1 = hLayout->parentWidget();
 	vLayout->addWidget(centralWidget1);
 	
-	QScalarWindow::feedingView->setScene(QScalarWindow::feedingScene);
-	QScalarWindow::positiveView->setScene(QScalarWindow::positiveScene);
-	QScalarWindow::negativeView->setScene(QScalarWindow::negativeScene);
-	
 	auto longer = false;
 	
-	for (const auto& view : { QScalarWindow::feedingView, QScalarWindow::positiveView, QScalarWindow::negativeView })
+	for (const auto& chart : { QScalarWindow::feedingChart, QScalarWindow::positiveChart, QScalarWindow::negativeChart })
 	{
-		view->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-		view->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-		view->setViewportUpdateMode(QGraphicsView::NoViewportUpdate);
-		view->setFocusPolicy(Qt::NoFocus);
-		
-		view->setMinimumWidth(longer ? 600 : 500);
-		view->setMinimumHeight(240);
+		chart->setFocusPolicy(Qt::NoFocus);
+		chart->setMinimumWidth(longer ? 600 : 500);
+		chart->setMinimumHeight(240);
 		longer = true;
 	}
 	
+	QScalarWindow::positiveCloneTable->setModel(&(QScalarWindow::positiveModel));
+	QScalarWindow::negativeCloneTable->setModel(&(QScalarWindow::negativeModel));
+	
 	QScalarWindow::positiveCloneTable->setMinimumWidth(1'000);
 	QScalarWindow::positiveCloneTable->setMouseTracking(true);
 	
@@ -309,9 +346,9 @@ QScalarWindow::QScalarWindow(void) :
 	vLayout->addWidget(centralWidget2);
 	vLayout->setStretch(0, 10);
 	
-	gLayout->addWidget(QScalarWindow::feedingView, 0, 0, 1, 6);
-	gLayout->addWidget(QScalarWindow::positiveView, 0, 6, 1, 1);
-	gLayout->addWidget(QScalarWindow::negativeView, 1, 6, 8, 1);
+	gLayout->addWidget(QScalarWindow::feedingChart, 0, 0, 1, 6);
+	gLayout->addWidget(QScalarWindow::positiveChart, 0, 6, 1, 1);
+	gLayout->addWidget(QScalarWindow::negativeChart, 1, 6, 8, 1);
 	
 	gLayout->addWidget(QScalarWindow::positiveCloneTable, 0, 7, 1, 1);
 	gLayout->addWidget(QScalarWindow::negativeCloneTable, 1, 7, 8, 1);
@@ -398,8 +435,19 @@ QScalarWindow::QScalarWindow(void) :
 	QObject::connect(&(QScalarWindow::scanThread), SIGNAL(started(void)), this, SLOT(toggleScan(void)));
 	QObject::connect(&(QScalarWindow::scanThread), SIGNAL(finished(void)), this, SLOT(toggleScan(void)));
 	
-	QObject::connect(&(QScalarWindow::feedThread), SIGNAL(triggerTerminalUpdate(HexTerminalFile*)), QScalarWindow::outputWindow, SLOT(updateTable(HexTerminalFile*)));
-	QObject::connect(&(QScalarWindow::scanThread), SIGNAL(triggerTerminalUpdate(HexTerminalFile*)), QScalarWindow::outputWindow, SLOT(updateTable(HexTerminalFile*)));
+	QScalarWindow::preloadTimer->setSingleShot(true);
+	QScalarWindow::preloadTimer->setInterval(QScalarWindow::PreloadDelay);
+	
+	for (const auto& e : { QScalarWindow::numberOfDaysEdit, QScalarWindow::timeUnitEdit, QScalarWindow::numberOfCandlesticksEdit, QScalarWindow::firstCoefficientEdit })
+		QObject::connect(e, SIGNAL(textEdited(const QString&)), QScalarWindow::preloadTimer, SLOT(start(void)));
+	
+	QObject::connect(QScalarWindow::choiceBox, SIGNAL(currentIndexChanged(int)), QScalarWindow::preloadTimer, SLOT(start(void)));
+	QObject::connect(QScalarWindow::preloadTimer, SIGNAL(timeout(void)), this, SLOT(preload(void)));
+	QObject::connect(this, SIGNAL(triggerSearchStart(bool)), this, SLOT(startSearch(bool)));
+	QObject::connect(this, SIGNAL(triggerSearchFinish()), this, SLOT(finishSearch()));
+	
+	QScalarWindow::outputWindow->attach(QScalarWindow::feedThread.terminalQueue());
+	QScalarWindow::outputWindow->attach(QScalarWindow::scanThread.terminalQueue());
 	
 	QScalarWindow::reset();
 	QMainWindow::move(QMainWindow::screen()->geometry().center() - QMainWindow::frameGeometry().center());
@@ -414,30 +462,18 @@ QScalarWindow::QScalarWindow(void) :
 
 void QScalarWindow::analyse(void)
 {
-	if (QScalarWindow::feedThread.isRunning())
-		return;
-	
 	const auto report = QScalarWindow::check(MissionEnum::Analyse);
 	
 	if (report.abort)
 		return;
 	
-	const auto invalid = not QScalarWindow::dataCollection.importDirectory(report.directory, report.numberOfDays);
-	
-	if (invalid)
+	if (not QScalarWindow::updateCoefficients(report))
 		return;
 	
 	const auto now = static_cast<qreal>(report.tradeTimeSpot)/static_cast<qreal>(QScalarWindow::candlesticksToBeAnalysed.size());
-	auto it = QScalarWindow::candlesticksToBeAnalysed.cbegin() + (report.tradeTimeSpot - report.timeUnit*report.numberOfCandlesticks);
-	
-	if (not QScalarWindow::scanThread.isRunning())
-	{
-		HexNormalisedInfo::UpdateCoefficients(report.firstCoefficient, report.numberOfCandlesticks);
-		QScalarWindow::dataCollection.setUpHistory(report.timeUnit, report.numberOfCandlesticks, report.scope);
-	}
+	const auto it = QScalarWindow::candlesticksToBeAnalysed.cbegin() + (report.tradeTimeSpot - report.timeUnit*report.numberOfCandlesticks);
 	
-	QScalarWindow::search(it, report.timeUnit, 1u, report.numberOfCandlesticks, report.numberOfCandidates, report.threshold, report.takeProfit, report.stopLoss, now, QScalarWindow::bestCheckBox->isChecked(),QScalarWindow::nemesisCheckBox->isChecked());
-	QScalarWindow::timeUpdateLabel->clear();
+	QScalarWindow::prepare(report, std::vector<HexCandlestick<qreal>>(it, it + report.timeUnit*report.numberOfCandlesticks), now);
 }
 
 HexCheckFile QScalarWindow::check(MissionEnum msn)
@@ -495,7 +531,7 @@ HexCheckFile QScalarWindow::check(MissionEnum msn)
 	{
 		foo.tradeTimeSpot = QScalarWindow::timeSpotEdit->text().toUInt();
 		QScalarWindow::recordAnalysis();
-	
+		
 		if (QScalarWindow::candlesticksToBeAnalysed.size() <= foo.tradeTimeSpot)
 			return foo;
 		
@@ -505,8 +541,32 @@ HexCheckFile QScalarWindow::check(MissionEnum msn)
 	else if (msn == MissionEnum::Feed)
 	{
 		const auto numberOfElementaryCandlesticks = foo.timeUnit*foo.numberOfCandlesticks;
+		foo.source = static_cast<SourceEnum>(QScalarWindow::sourceBox->currentIndex());
+		foo.latencyBudget = QScalarWindow::latencyEdit->text().toUInt();
+		foo.replaySpeed = QScalarWindow::speedEdit->text().toUInt();
+		foo.companions = QScalarWindow::crossEdit->text().split(',', Qt::SkipEmptyParts);
+		foo.companions.removeAll(foo.directory);
+		foo.companions.removeDuplicates();
 		
-		while (QFeedingThread::RealTimeCandlesticks*foo.feedingTimeUnit <= numberOfElementaryCandlesticks)
+		for (const auto& companion : foo.companions)
+		{
+			if (QScalarWindow::choiceBox->findText(companion) < 0)
+				return foo;
+		}
+		
+		if (foo.source == SourceEnum::Replay)
+		{
+			foo.replayPath = QFileDialog::getOpenFileName(this, "Replay", QString(), "Day files and journals (*.txt *.bin)");
+			
+			if (foo.replayPath.isEmpty())
+				return foo;
+			
+			foo.replayPath = QDir().relativeFilePath(foo.replayPath);
+		}
+		
+		const auto pixelFeed = (foo.source == SourceEnum::Screen or foo.replayPath.endsWith(".bin"));
+		
+		while (pixelFeed and QFeedingThread::RealTimeCandlesticks*foo.feedingTimeUnit <= numberOfElementaryCandlesticks)
 			++foo.feedingTimeUnit;
 		
 		if (foo.timeUnit % foo.feedingTimeUnit != 0u)
@@ -519,8 +579,34 @@ HexCheckFile QScalarWindow::check(MissionEnum msn)
 
 void QScalarWindow::closeEvent(QCloseEvent*)
 {
+	QScalarWindow::previews.stop();
+	QScalarWindow::staging.token.cancel();
 	QScalarWindow::scanThread.stop();
 	QScalarWindow::feedThread.stop();
+	QScalarWindow::scanThread.wait();
+	QScalarWindow::feedThread.wait();
+	
+	if (QScalarWindow::preloadToken != nullptr)
+		QScalarWindow::preloadToken->cancel();
+	
+	if (QScalarWindow::preparation != nullptr)
+	{
+		QScalarWindow::preparation->wait();
+		delete QScalarWindow::preparation;
+		QScalarWindow::preparation = nullptr;
+	}
+	
+	for (const auto preload : QScalarWindow::preloads)
+	{
+		preload->wait();
+		delete preload;
+	}
+	
+	QScalarWindow::preloads.clear();
+	QScalarWindow::queuedSearch = nullptr;
+	
+	if (QScalarWindow::searching.valid())
+		QScalarWindow::searching.wait();
 }
 
 void QScalarWindow::deleteCandlestick(void)
@@ -548,36 +634,8 @@ void QScalarWindow::deleteCandlestick(void)
 	}
 }
 
-std::vector<HexCandlestick<qreal>> QScalarWindow::ExtractCandlesticks(std::vector<HexCandlestick<qreal>>::const_iterator it, quint32 timeUnit, quint32 numberOfCandlesticks)
-{
-	std::vector<HexCandlestick<qreal>> candlesticks;
-	candlesticks.reserve(numberOfCandlesticks);
-	
-	for (auto i = 0u; i < numberOfCandlesticks; ++i)
-	{
-		auto& cs = candlesticks.emplace_back(it->low, it->high);
-		++it;
-		
-		for (auto j = 1u; j < timeUnit; ++j)
-		{
-			if (it->low < cs.low)
-				cs.low = it->low;
-			
-			if (it->high > cs.high)
-				cs.high = it->high;
-			
-			++it;
-		}
-	}
-	
-	return candlesticks;
-}
-
 void QScalarWindow::feed(void)
 {
-	if (QScalarWindow::scanThread.isRunning())
-		return;
-	
 	if (QScalarWindow::feedThread.isRunning())
 		return QScalarWindow::feedThread.stop();
 	
@@ -588,18 +646,31 @@ void QScalarWindow::feed(void)
 	if (report.abort or gapInvalid)
 		return;
 	
-	HexNormalisedInfo::UpdateCoefficients(report.firstCoefficient, report.numberOfCandlesticks);
-	QScalarWindow::outputWindow->setUp(report.feedingTimeUnit, report.numberOfCandidates, report.threshold*100., report.takeProfit);
+	if (not QScalarWindow::updateCoefficients(report))
+		return;
+	
+	if (not QScalarWindow::scanThread.isRunning())
+		QScalarWindow::outputWindow->setUp(report.feedingTimeUnit, report.numberOfCandidates, report.threshold*100., report.takeProfit);
 	
 	QScalarWindow::feedThread.setUp(report, gap, QScalarWindow::bestCheckBox->isChecked(), QScalarWindow::nemesisCheckBox->isChecked());
 	QScalarWindow::feedThread.start(QThread::HighPriority);
 }
 
-void QScalarWindow::locate(void)
+void QScalarWindow::finishSearch(void)
 {
-	if (QScalarWindow::feedThread.isRunning())
-		return;
+	QScalarWindow::searching.get();
+	QScalarWindow::finishedSearch();
 	
+	if (QScalarWindow::queuedSearch)
+	{
+		const auto next = std::move(QScalarWindow::queuedSearch);
+		QScalarWindow::queuedSearch = nullptr;
+		next();
+	}
+}
+
+void QScalarWindow::locate(void)
+{
 	const auto report = QScalarWindow::check(MissionEnum::Locate);
 	
 	if (report.abort)
@@ -622,19 +693,95 @@ void QScalarWindow::locate(void)
 	if (candlesticks.empty())
 		return;
 	
-	const auto invalid = not QScalarWindow::dataCollection.importDirectory(report.directory, report.numberOfDays);
+	if (not QScalarWindow::updateCoefficients(report))
+		return;
 	
-	if (invalid)
+	QScalarWindow::prepare(report, std::move(candlesticks), 10.);
+}
+
+void QScalarWindow::preload(void)
+{
+	HexCheckFile foo;
+	
+	foo.directory = QScalarWindow::choiceBox->currentText();
+	foo.numberOfDays = QScalarWindow::numberOfDaysEdit->text().toUInt();
+	foo.timeUnit = QScalarWindow::timeUnitEdit->text().toUInt();
+	foo.numberOfCandlesticks = QScalarWindow::numberOfCandlesticksEdit->text().toUInt();
+	foo.firstCoefficient = QScalarWindow::firstCoefficientEdit->text().toDouble()/100.;
+	
+	if (foo.directory.isEmpty() or foo.numberOfDays < 1u or foo.timeUnit < 1u)
 		return;
 	
-	if (not QScalarWindow::scanThread.isRunning())
+	if (foo.numberOfCandlesticks < 1u or foo.numberOfCandlesticks > 120u or foo.timeUnit*foo.numberOfCandlesticks > 9'999u)
+		return;
+	
+	if (foo.firstCoefficient <= 0. or foo.firstCoefficient > 1.)
+		return;
+	
+	if (QScalarWindow::preloadToken != nullptr)
 	{
-		HexNormalisedInfo::UpdateCoefficients(report.firstCoefficient, report.numberOfCandlesticks);
-		QScalarWindow::dataCollection.setUpHistory(report.timeUnit, report.numberOfCandlesticks, report.scope);
+		if (not QScalarWindow::preloadToken->isCancelled() and QScalarWindow::preloadReport.sharesData(foo))
+			return;
+		
+		QScalarWindow::preloadToken->cancel();
 	}
 	
-	QScalarWindow::search(candlesticks.cbegin(), report.timeUnit, 1u, report.numberOfCandlesticks, report.numberOfCandidates, report.threshold, report.takeProfit, report.stopLoss, 10., QScalarWindow::bestCheckBox->isChecked(), QScalarWindow::nemesisCheckBox->isChecked());
-	QScalarWindow::timeUpdateLabel->clear();
+	std::erase_if(QScalarWindow::preloads, [](const auto preload)
+	{
+		if (not preload->isFinished())
+			return false;
+		
+		delete preload;
+		return true;
+	});
+	
+	const auto token = std::make_shared<HexCancelToken>();
+	QScalarWindow::preloadToken = token;
+	QScalarWindow::preloadReport = foo;
+	
+	QScalarWindow::preloads.push_back(QThread::create([this, token, foo]()
+	{
+		QScalarWindow::dataCollection.preload(*token, foo.directory, foo.numberOfDays, foo.timeUnit, foo.numberOfCandlesticks, foo.firstCoefficient);
+	}));
+	
+	QScalarWindow::preloads.back()->start(QThread::LowPriority);
+}
+
+void QScalarWindow::prepare(const HexCheckFile& report, std::vector<HexCandlestick<qreal>>&& query, qreal now)
+{
+	if (QScalarWindow::preparing)
+	{
+		std::cout << "A search is already being prepared." << std::endl;
+		return;
+	}
+	
+	if (QScalarWindow::preloadToken != nullptr and not QScalarWindow::preloadReport.sharesData(report))
+		QScalarWindow::preloadToken->cancel();
+	
+	const auto best = QScalarWindow::bestCheckBox->isChecked();
+	const auto nemesis = QScalarWindow::nemesisCheckBox->isChecked();
+	
+	QScalarWindow::preparedSearch = [this, report, query = std::move(query), now, best, nemesis]() mutable
+	{
+		QScalarWindow::search(QScalarWindow::staging.snapshot, QScalarWindow::staging.scope, std::move(query), report.timeUnit, 1u, report.numberOfCandlesticks, report.numberOfCandidates, report.threshold, report.takeProfit, report.stopLoss, now, best, nemesis);
+	};
+	
+	QScalarWindow::preparing = true;
+	QScalarWindow::staging.token.reset();
+	
+	if (QScalarWindow::preparation != nullptr)
+	{
+		QScalarWindow::preparation->wait();
+		delete QScalarWindow::preparation;
+	}
+	
+	QScalarWindow::preparation = QThread::create([this, report]()
+	{
+		const auto ready = QScalarWindow::dataCollection.acquire(QScalarWindow::staging, report.directory, report.numberOfDays, report.timeUnit, report.numberOfCandlesticks, report.scope);
+		QScalarWindow::triggerSearchStart(ready);
+	});
+	
+	QScalarWindow::preparation->start(QThread::HighPriority);
 }
 
 void QScalarWindow::recordAnalysis(void)
@@ -687,20 +834,21 @@ void QScalarWindow::reset(void)
 	QScalarWindow::takeProfitEdit->setText("10");
 	QScalarWindow::stopLossEdit->setText("15");
 	
+	QScalarWindow::crossEdit->clear();
 	QScalarWindow::gapEdit->setText("1");
+	QScalarWindow::latencyEdit->setText("50");
+	QScalarWindow::speedEdit->setText("0");
 	QScalarWindow::balanceEdit->setText("80");
 	QScalarWindow::thresholdCheckBox->setChecked(true);
 	
 	QScalarWindow::updatePanel(nullptr);
 	QScalarWindow::updateTables();
 	QScalarWindow::updateViews(true);
+	QScalarWindow::preloadTimer->start();
 }
 
 void QScalarWindow::scan(void)
 {
-	if (QScalarWindow::feedThread.isRunning())
-		return;
-	
 	if (QScalarWindow::scanThread.isRunning())
 		return QScalarWindow::scanThread.stop();
 	
@@ -709,29 +857,64 @@ void QScalarWindow::scan(void)
 	if (report.abort)
 		return;
 	
-	HexNormalisedInfo::UpdateCoefficients(report.firstCoefficient, report.numberOfCandlesticks);
-	QScalarWindow::outputWindow->setUp(0u, report.numberOfCandidates, report.threshold*100., report.takeProfit);
+	if (not QScalarWindow::updateCoefficients(report))
+		return;
+	
+	if (not QScalarWindow::feedThread.isRunning())
+		QScalarWindow::outputWindow->setUp(0u, report.numberOfCandidates, report.threshold*100., report.takeProfit);
 	
 	QScalarWindow::scanThread.setUp(report, QScalarWindow::bestCheckBox->isChecked(), QScalarWindow::nemesisCheckBox->isChecked(), QScalarWindow::candlesticksToBeAnalysed);
 	QScalarWindow::scanThread.start(QThread::HighPriority);
 }
 
-void QScalarWindow::search(std::vector<HexCandlestick<qreal>>::const_iterator it, quint32 timeUnit, quint32 feedingTimeUnit, quint32 numberOfCandlesticks, quint32 numberOfCandidates, qreal threshold, qreal takeProfit, qreal stopLoss, qreal now, bool bestOverGraduates, bool nemesis)
+void QScalarWindow::search(std::shared_ptr<const HexDataSnapshot> snapshot, quint32 scope, std::vector<HexCandlestick<qreal>>&& query, quint32 timeUnit, quint32 feedingTimeUnit, quint32 numberOfCandlesticks, quint32 numberOfCandidates, qreal threshold, qreal takeProfit, qreal stopLoss, qreal now, bool bestOverGraduates, bool nemesis)
 {
-	if (bestOverGraduates)
-		QScalarWindow::dataCollection.locateBest(it, timeUnit, feedingTimeUnit, numberOfCandlesticks, numberOfCandidates, now, nemesis, false);
-	else
-		QScalarWindow::dataCollection.locateGraduates(it, timeUnit, feedingTimeUnit, numberOfCandlesticks, threshold, now, nemesis, false);
+	// Only the latest request waits behind a running search, older ones are already stale.
+	if (QScalarWindow::searching.valid())
+	{
+		QScalarWindow::queuedSearch = [=, this, query = std::move(query)]() mutable
+		{
+			QScalarWindow::search(snapshot, scope, std::move(query), timeUnit, feedingTimeUnit, numberOfCandlesticks, numberOfCandidates, threshold, takeProfit, stopLoss, now, bestOverGraduates, nemesis);
+		};
+		
+		return;
+	}
 	
-	QScalarWindow::dataCollection.fullStudy(takeProfit, stopLoss);
-	const auto report = QScalarWindow::dataCollection.fullReport(takeProfit, stopLoss);
-	QScalarWindow::updatePanel(&report);
+	QScalarWindow::results.attach(std::move(snapshot), scope);
+	QScalarWindow::searchedQuery = std::move(query);
 	
-	const auto candlesticks = QScalarWindow::ExtractCandlesticks(it, timeUnit/feedingTimeUnit, numberOfCandlesticks);
-	QScalarWindow::updateCandlesticks(QScalarWindow::feedingScene, QScalarWindow::feedingView, candlesticks, numberOfCandlesticks, 4.f);
+	QScalarWindow::searching = QScalarWindow::workers.launch(QoSEnum::Interactive, [=, this]()
+	{
+		const auto it = QScalarWindow::searchedQuery.cbegin();
+		
+		if (bestOverGraduates)
+			QScalarWindow::dataCollection.locateBest(QScalarWindow::results, it, timeUnit, feedingTimeUnit, numberOfCandlesticks, numberOfCandidates, now, nemesis, false);
+		else
+			QScalarWindow::dataCollection.locateGraduates(QScalarWindow::results, it, timeUnit, feedingTimeUnit, numberOfCandlesticks, threshold, now, nemesis, false);
+		
+		QScalarWindow::dataCollection.fullStudy(QScalarWindow::results, takeProfit, stopLoss);
+		QScalarWindow::triggerSearchFinish();
+	});
 	
-	QScalarWindow::updateTables();
-	QScalarWindow::updateViews(false);
+	QScalarWindow::finishedSearch = [this, timeUnit, feedingTimeUnit, numberOfCandlesticks, takeProfit, stopLoss]()
+	{
+		const auto report = QScalarWindow::dataCollection.fullReport(QScalarWindow::results, takeProfit, stopLoss);
+		QScalarWindow::updatePanel(&report);
+		
+		const auto candlesticks = HexKernelSwitch::Dispatch(numberOfCandlesticks, [&](auto kernel)
+		{
+			return decltype(kernel)::ExtractCandlesticks(QScalarWindow::searchedQuery.cbegin(), timeUnit/feedingTimeUnit, numberOfCandlesticks);
+		});
+		
+		QScalarWindow::feedingChart->setCandlesticks(candlesticks, numberOfCandlesticks, 4.f);
+		
+		QScalarWindow::updateTables();
+		QScalarWindow::updateViews(false);
+		QScalarWindow::previews.prepare();
+		
+		QScalarWindow::positiveChart->setOverlay(candlesticks);
+		QScalarWindow::negativeChart->setOverlay(candlesticks);
+	};
 }
 
 void QScalarWindow::showNegativeCandlesticks(const QModelIndex& index)
@@ -739,10 +922,13 @@ void QScalarWindow::showNegativeCandlesticks(const QModelIndex& index)
 	if (index.column() == QScalarWindow::currentNegativeColumn)
 		return;
 	
-	const auto candlesticks = QScalarWindow::dataCollection.getCandlesticks(index.column(), false);
+	const auto cached = QScalarWindow::previews.find(index.column(), false);
 	const auto numberOfRealCandlesticks = QScalarWindow::numberOfCandlesticksEdit->text().toUInt();
 	
-	QScalarWindow::updateCandlesticks(QScalarWindow::negativeScene, QScalarWindow::negativeView, candlesticks, numberOfRealCandlesticks, 4.f);
+	if (cached != nullptr)
+		QScalarWindow::negativeChart->setCandlesticks(*cached, numberOfRealCandlesticks, 4.f);
+	else if (not QScalarWindow::searching.valid())
+		QScalarWindow::negativeChart->setCandlesticks(QScalarWindow::results.snapshot->getCandlesticks(QScalarWindow::negativeModel.precedent(index.column())), numberOfRealCandlesticks, 4.f);
 	QScalarWindow::currentNegativeColumn = index.column();
 }
 
@@ -751,25 +937,39 @@ void QScalarWindow::showPositiveCandlesticks(const QModelIndex& index)
 	if (index.column() == QScalarWindow::currentPositiveColumn)
 		return;
 	
-	const auto candlesticks = QScalarWindow::dataCollection.getCandlesticks(index.column(), true);
+	const auto cached = QScalarWindow::previews.find(index.column(), true);
 	const auto numberOfRealCandlesticks = QScalarWindow::numberOfCandlesticksEdit->text().toUInt();
 	
-	QScalarWindow::updateCandlesticks(QScalarWindow::positiveScene, QScalarWindow::positiveView, candlesticks, numberOfRealCandlesticks, 4.f);
+	if (cached != nullptr)
+		QScalarWindow::positiveChart->setCandlesticks(*cached, numberOfRealCandlesticks, 4.f);
+	else if (not QScalarWindow::searching.valid())
+		QScalarWindow::positiveChart->setCandlesticks(QScalarWindow::results.snapshot->getCandlesticks(QScalarWindow::positiveModel.precedent(index.column())), numberOfRealCandlesticks, 4.f);
 	QScalarWindow::currentPositiveColumn = index.column();
 }
 
+void QScalarWindow::startSearch(bool ready)
+{
+	QScalarWindow::preparing = false;
+	
+	if (not ready)
+		return;
+	
+	QScalarWindow::preparedSearch();
+	QScalarWindow::timeUpdateLabel->clear();
+}
+
 void QScalarWindow::toggleFeed(void)
 {
 	const auto feeding = (QScalarWindow::feedButton->text() == "Feed");
 	QScalarWindow::feedButton->setText(feeding ? "Feeding..." : "Feed");
-	QScalarWindow::toggleWidgets(feeding);
+	QScalarWindow::toggleWidgets(feeding or QScalarWindow::scanButton->text() != "Scan");
 }
 
 void QScalarWindow::toggleScan(void)
 {
 	const auto scanning = (QScalarWindow::scanButton->text() == "Scan");
 	QScalarWindow::scanButton->setText(scanning ? "Scanning..." : "Scan");
-	QScalarWindow::toggleWidgets(scanning);
+	QScalarWindow::toggleWidgets(scanning or QScalarWindow::feedButton->text() != "Feed");
 }
 
 void QScalarWindow::toggleWidgets(bool foo)
@@ -783,11 +983,15 @@ void QScalarWindow::toggleWidgets(bool foo)
 	QScalarWindow::bestEdit->setReadOnly(foo);
 	QScalarWindow::thresholdEdit->setReadOnly(foo);
 	QScalarWindow::balanceEdit->setReadOnly(foo);
+	QScalarWindow::crossEdit->setReadOnly(foo);
 	QScalarWindow::gapEdit->setReadOnly(foo);
+	QScalarWindow::latencyEdit->setReadOnly(foo);
+	QScalarWindow::speedEdit->setReadOnly(foo);
 	QScalarWindow::takeProfitEdit->setReadOnly(foo);
 	QScalarWindow::stopLossEdit->setReadOnly(foo);
 	
 	QScalarWindow::choiceBox->setEnabled(not foo);
+	QScalarWindow::sourceBox->setEnabled(not foo);
 	QScalarWindow::bestCheckBox->setEnabled(not foo);
 	QScalarWindow::thresholdCheckBox->setEnabled(not foo);
 	QScalarWindow::nemesisCheckBox->setEnabled(not foo);
@@ -798,7 +1002,7 @@ void QScalarWindow::triggerSearch(HexUpdateFile* bigFile)
 	const auto newTime = QTime::currentTime().toString("hh:mm:ss");
 	QScalarWindow::timeUpdateLabel->setText("Last analysis at " + newTime + '.');
 	
-	QScalarWindow::search(bigFile->candlesticks.cbegin(), bigFile->timeUnit, bigFile->feedingTimeUnit, bigFile->numberOfCandlesticks, bigFile->numberOfCandidates, bigFile->threshold, bigFile->takeProfit, bigFile->stopLoss, bigFile->now, bigFile->bestOverGraduates, bigFile->nemesis);
+	QScalarWindow::search(bigFile->snapshot, bigFile->scope, std::move(bigFile->candlesticks), bigFile->timeUnit, bigFile->feedingTimeUnit, bigFile->numberOfCandlesticks, bigFile->numberOfCandidates, bigFile->threshold, bigFile->takeProfit, bigFile->stopLoss, bigFile->now, bigFile->bestOverGraduates, bigFile->nemesis);
 	delete bigFile;
 	
 	//QWidget::showNormal();
@@ -806,42 +1010,19 @@ void QScalarWindow::triggerSearch(HexUpdateFile* bigFile)
 	//QWidget::activateWindow();
 }
 
-void QScalarWindow::updateCandlesticks(QGraphicsScene* scene, QGraphicsView* view, const std::vector<HexCandlestick<qreal>>& candlesticks, quint32 numberOfRealCandlesticks, qreal flat) const
+bool QScalarWindow::updateCoefficients(const HexCheckFile& report)
 {
-	auto maxHeight = -std::numeric_limits<qreal>::max();
-	auto minHeight = std::numeric_limits<qreal>::max();
-	
-	auto candlestickDrawn = 0u;
-	auto x = 0.f;
-	
-	QPen pen(Qt::transparent);
-	pen.setWidth(0);
-	scene->clear();
-	
-	for (const auto& c : candlesticks)
+	if (not QScalarWindow::feedThread.isRunning() and not QScalarWindow::scanThread.isRunning() and not QScalarWindow::preparing and not QScalarWindow::searching.valid())
 	{
-		const auto rect = (c.high != c.low ? QRectF(x + 0.1f, -c.high, 0.8f, c.high - c.low) : QRectF(x + 0.1f, -c.high - flat/2.f, 0.8f, flat));
-		const auto item = scene->addRect(rect, pen);
-		item->setBrush(candlestickDrawn < numberOfRealCandlesticks ? QColor(153, 153, 153) : QColor(204, 204, 204));
-		
-		if (rect.top() < minHeight)
-			minHeight = rect.top();
-		
-		if (rect.bottom() > maxHeight)
-			maxHeight = rect.bottom();
-		
-		x += 1.f;
-		++candlestickDrawn;
+		HexNormalisedInfo::UpdateCoefficients(report.firstCoefficient, report.numberOfCandlesticks);
+		return true;
 	}
 	
-	const auto spread = maxHeight - minHeight;
-	minHeight -= spread/20.f;
-	maxHeight += spread/20.f;
+	if (HexNormalisedInfo::SameCoefficients(report.firstCoefficient, report.numberOfCandlesticks))
+		return true;
 	
-	const auto entireRect = QRectF(0.f, minHeight, x, maxHeight - minHeight);
-	scene->setSceneRect(entireRect);
-	view->fitInView(entireRect);
-	scene->update();
+	std::cout << "Coefficients are in use by a running search." << std::endl;
+	return false;
 }
 
 void QScalarWindow::updateGap(qreal gap)
@@ -901,29 +1082,19 @@ void QScalarWindow::updatePanel(const HexFullReport* report) const
 void QScalarWindow::updateTables(void)
 {
 	QScalarWindow::currentPositiveColumn = -1;
-	QScalarWindow::positiveCloneTable->setModel(nullptr);
-	QScalarWindow::positiveCloneTable->reset();
-	QScalarWindow::positiveCloneTable->setModel(&(QScalarWindow::positiveModel));
+	QScalarWindow::positiveModel.update(QScalarWindow::results.positivePrecedents);
 	
 	QScalarWindow::currentNegativeColumn = -1;
-	QScalarWindow::negativeCloneTable->setModel(nullptr);
-	QScalarWindow::negativeCloneTable->reset();
-	QScalarWindow::negativeCloneTable->setModel(&(QScalarWindow::negativeModel));
+	QScalarWindow::negativeModel.update(QScalarWindow::results.negativePrecedents);
 }
 
 void QScalarWindow::updateViews(bool clearGeneral) const
 {
-	QScalarWindow::positiveScene->clear();
-	QScalarWindow::positiveScene->update();
-	
-	QScalarWindow::negativeScene->clear();
-	QScalarWindow::negativeScene->update();
+	QScalarWindow::positiveChart->clear();
+	QScalarWindow::negativeChart->clear();
 	
 	if (clearGeneral)
-	{
-		QScalarWindow::feedingScene->clear();
-		QScalarWindow::feedingScene->update();
-	}
+		QScalarWindow::feedingChart->clear();
 }
 
 void QScalarWindow::updateVolume(int value)
@@ -2,100 +2,96 @@
 #define __TERMINAL_MODEL_HPP__
 
 // Qt Libraries
- #include <QAbstractTableModel>
- #include <QBrush>
- 
+ #include <QColor>
+ #include <QFile>
+ #include <QObject>
+
+// Standard Libraries
+#include <iostream>
+
  // Personal Libraries
 #include "OtherClasses.hpp"
 
-class QTerminalModel : public QAbstractTableModel
+class QTerminalModel : public QObject
 {
 	Q_OBJECT
 	
 	private:
 	
+		static constexpr quint32			Capacity = 16'384u;
+		static const QString				SpillPath;
+		
+		inline static QString				BestsString(const std::array<qreal, 8u>&, quint32);
 		inline static QString				TimeString(quint32);
 		
 		std::vector<HexTerminalFile>			logs;
+		QFile						spill;
+		const uchar*					spillMap = nullptr;
+		HexTerminalFile					missing;
+		quint32						numberOfRows = 0u;
+		quint32						numberOfSpilledRows = 0u;
+		quint32						numberOfMappedRows = 0u;
 		quint32						period = 0u;
 		quint32						numberOfCandidates;
 		qreal						takeProfit;
 		qreal						threshold;
 		
-		inline QVariant					retrieveAlignment(const QModelIndex&) const;
-		inline QVariant					retrieveBackground(const QModelIndex&) const;
-		inline QVariant					retrieveForeground(const QModelIndex&) const;
-		inline QVariant					retrieveData(const QModelIndex&) const;
+		inline const HexTerminalFile&			entry(quint32) const;
+		inline void					remap(void);
+		inline void					spillIncoming(const HexTerminalFile*, quint32);
+		inline void					spillResident(quint32);
 	
 	public:
 	
 		inline QTerminalModel(void);
+		inline ~QTerminalModel(void);
 		
-		inline qint32					columnCount(const QModelIndex&) const override;
-		inline QVariant					data(const QModelIndex&, qint32) const override;
-		inline qint32					process(HexTerminalFile*);
-		inline qint32					rowCount(const QModelIndex&) const override;
+		inline QColor					background(quint32, qint32) const;
+		inline QColor					foreground(quint32, qint32) const;
+		inline bool					leftAligned(qint32) const;
+		inline qint32					process(const HexTerminalFile*, quint32);
+		inline quint32					rowCount(void) const;
 		inline void					setUp(quint32, quint32, qreal, qreal);
+		inline bool					spanned(quint32) const;
+		inline QString					text(quint32, qint32) const;
 };
 
-QTerminalModel::QTerminalModel(void)
-{
-	QTerminalModel::logs.reserve(100'000u);
-}
-
-qint32 QTerminalModel::columnCount(const QModelIndex&) const
+QString QTerminalModel::BestsString(const std::array<qreal, 8u>& bests, quint32 numberOfBests)
 {
-	return 14;
-}
-
-QVariant QTerminalModel::data(const QModelIndex& index, qint32 role = Qt::DisplayRole) const
-{
-	switch (role)
-	{
-		case Qt::TextAlignmentRole:
-			return QTerminalModel::retrieveAlignment(index);
-		
-		case Qt::BackgroundRole:
-			return QTerminalModel::retrieveBackground(index);
-		
-		case Qt::DisplayRole:
-			return QTerminalModel::retrieveData(index);
-		
-		case Qt::ForegroundRole:
-			return QTerminalModel::retrieveForeground(index);
-	}
+	QString text;
+	
+	for (auto i = 0u; i < numberOfBests; ++i)
+		text += (bests[i] != 0. ? QString::number(static_cast<double>(bests[i]), 'f', 6).left(4u) : QString("xxxx")) + "  ";
 	
-	return QVariant();
+	text.chop(2u);
+	return text;
 }
 
-qint32 QTerminalModel::process(HexTerminalFile* foo)
+QTerminalModel::QTerminalModel(void) :
+	logs(QTerminalModel::Capacity),
+	spill(QTerminalModel::SpillPath)
 {
-	const auto size = static_cast<qint32>(QTerminalModel::logs.size());
-	QAbstractItemModel::beginInsertRows(QModelIndex(), size, size);
-	QTerminalModel::logs.push_back(*foo);
-	QAbstractItemModel::endInsertRows();
-	return size;
 }
 
-QVariant QTerminalModel::retrieveAlignment(const QModelIndex& index) const
+QTerminalModel::~QTerminalModel(void)
 {
-	const auto column = index.column();
-	return (column >= 7 and column != 10 ? QVariant::fromValue(Qt::AlignLeft | Qt::AlignVCenter) : Qt::AlignCenter);
+	if (QTerminalModel::spillMap != nullptr)
+		QTerminalModel::spill.unmap(const_cast<uchar*>(QTerminalModel::spillMap));
+	
+	QTerminalModel::spill.close();
+	QTerminalModel::spill.remove();
 }
 
-QVariant QTerminalModel::retrieveBackground(const QModelIndex& index) const
+QColor QTerminalModel::background(quint32 row, qint32 column) const
 {
-	if (QTerminalModel::logs.empty())
+	if (QTerminalModel::numberOfRows == 0u)
 		return QColor(Qt::black);
 	
-	const auto row = static_cast<quint32>(index.row());
+	if (QTerminalModel::numberOfRows == row)
+		return (QTerminalModel::period == 0u or (QTerminalModel::entry(row - 1u).realTime/QTerminalModel::period) % 2u == 0u ? QColor(Qt::black) : QColor(30, 30, 30));
 	
-	if (QTerminalModel::logs.size() == row)
-		return (QTerminalModel::period == 0u or (QTerminalModel::logs.back().realTime/QTerminalModel::period) % 2u == 0u ? QColor(Qt::black) : QColor(30, 30, 30));
+	const auto& file = QTerminalModel::entry(row);
 	
-	const auto& file = QTerminalModel::logs[row];
-	const auto column = index.column();
-		
 	switch (column)
 	{
 		case 7:
@@ -153,14 +149,177 @@ QVariant QTerminalModel::retrieveBackground(const QModelIndex& index) const
 	return (QTerminalModel::period == 0u or (file.realTime/QTerminalModel::period) % 2u == 0u ? QColor(Qt::black) : QColor(30, 30, 30));
 }
 
-QVariant QTerminalModel::retrieveData(const QModelIndex& index) const
+const HexTerminalFile& QTerminalModel::entry(quint32 row) const
 {
-	const auto row = static_cast<quint32>(index.row());
+	if (row >= QTerminalModel::numberOfSpilledRows)
+		return QTerminalModel::logs[row % QTerminalModel::Capacity];
 	
-	if (QTerminalModel::logs.size() != row)
+	if (row >= QTerminalModel::numberOfMappedRows)
+		return QTerminalModel::missing;
+	
+	return reinterpret_cast<const HexTerminalFile*>(QTerminalModel::spillMap)[row];
+}
+
+QColor QTerminalModel::foreground(quint32 row, qint32 column) const
+{
+	if (QTerminalModel::numberOfRows != row)
 	{
-		const auto column = index.column();
-		const auto& file = QTerminalModel::logs[row];
+		if (column < 4 or column == 6)
+			return QColor(Qt::white);
+		
+		const auto& file = QTerminalModel::entry(row);
+		
+		switch (column)
+		{
+			case 4:
+				return (file.worstSimilarity >= QTerminalModel::threshold ? QColor(135, 215, 0) : QColor(255, 175, 0));
+			
+			case 5:
+				return (file.numberOfSamples >= QTerminalModel::numberOfCandidates ? QColor(135, 215, 0) : QColor(255, 175, 0));
+			
+			case 7:
+				return (file.ratio == 0u or file.buy70 < QTerminalModel::takeProfit ? QColor(95, 215, 255) : QColor(Qt::white));
+			
+			case 8:
+				return (file.ratio == 0u or file.buy80 < QTerminalModel::takeProfit ? QColor(95, 215, 255) : QColor(Qt::white));
+			
+			case 9:
+				return (file.ratio == 0u or file.buy90 < QTerminalModel::takeProfit ? QColor(95, 215, 255) : QColor(Qt::white));
+			
+			case 10:
+			{
+				switch (file.ratio/1'000u)
+				{
+					case 1u:
+						return QColor(95, 215, 255);
+					
+					case 2u:
+						return QColor(188, 188, 188);
+					
+					case 3u:
+						return QColor(255, 95, 0);
+				}
+				
+				break;
+			}
+			
+			case 11:
+				return (file.ratio == 0u or file.sell70 < QTerminalModel::takeProfit ? QColor(255, 95, 0) : QColor(Qt::white));
+			
+			case 12:
+				return (file.ratio == 0u or file.sell80 < QTerminalModel::takeProfit ? QColor(255, 95, 0) : QColor(Qt::white));
+			
+			case 13:
+				return (file.ratio == 0u or file.sell90 < QTerminalModel::takeProfit ? QColor(255, 95, 0) : QColor(Qt::white));
+		}
+	}
+	
+	return QColor(Qt::white);
+}
+
+bool QTerminalModel::leftAligned(qint32 column) const
+{
+	return (column >= 7 and column != 10);
+}
+
+qint32 QTerminalModel::process(const HexTerminalFile* files, quint32 count)
+{
+	const auto size = static_cast<qint32>(QTerminalModel::numberOfRows);
+	if (count > QTerminalModel::Capacity)
+	{
+		QTerminalModel::spillResident(QTerminalModel::numberOfRows - QTerminalModel::numberOfSpilledRows);
+		QTerminalModel::spillIncoming(files, count - QTerminalModel::Capacity);
+		files += count - QTerminalModel::Capacity;
+		count = QTerminalModel::Capacity;
+	}
+	
+	const auto resident = QTerminalModel::numberOfRows - QTerminalModel::numberOfSpilledRows;
+	
+	if (resident + count > QTerminalModel::Capacity)
+		QTerminalModel::spillResident(resident + count - QTerminalModel::Capacity);
+	
+	for (auto i = 0u; i < count; ++i)
+	{
+		QTerminalModel::logs[QTerminalModel::numberOfRows % QTerminalModel::Capacity] = files[i];
+		++QTerminalModel::numberOfRows;
+	}
+	
+	QTerminalModel::remap();
+	return size;
+}
+
+void QTerminalModel::remap(void)
+{
+	if (not QTerminalModel::spill.isOpen() or QTerminalModel::numberOfMappedRows == QTerminalModel::numberOfSpilledRows)
+		return;
+	
+	if (QTerminalModel::spillMap != nullptr)
+		QTerminalModel::spill.unmap(const_cast<uchar*>(QTerminalModel::spillMap));
+	
+	QTerminalModel::spill.flush();
+	QTerminalModel::spillMap = QTerminalModel::spill.map(0, static_cast<qint64>(QTerminalModel::numberOfSpilledRows)*static_cast<qint64>(sizeof(HexTerminalFile)));
+	QTerminalModel::numberOfMappedRows = (QTerminalModel::spillMap != nullptr ? QTerminalModel::numberOfSpilledRows : 0u);
+}
+
+quint32 QTerminalModel::rowCount(void) const
+{
+	return QTerminalModel::numberOfRows;
+}
+
+void QTerminalModel::setUp(quint32 p, quint32 nc, qreal th, qreal tp)
+{
+	if (QTerminalModel::spillMap != nullptr)
+		QTerminalModel::spill.unmap(const_cast<uchar*>(QTerminalModel::spillMap));
+	
+	QTerminalModel::spill.close();
+	QTerminalModel::spillMap = nullptr;
+	QTerminalModel::numberOfRows = 0u;
+	QTerminalModel::numberOfSpilledRows = 0u;
+	QTerminalModel::numberOfMappedRows = 0u;
+	
+	if (not QTerminalModel::spill.open(QIODevice::ReadWrite | QIODevice::Truncate))
+		std::cout << "Could not write file [" << QTerminalModel::SpillPath.toStdString() << "]." << std::endl;
+	
+	QTerminalModel::period = p;
+	QTerminalModel::numberOfCandidates = nc;
+	QTerminalModel::threshold = static_cast<qreal>(th);
+	QTerminalModel::takeProfit = static_cast<qreal>(tp);
+}
+
+bool QTerminalModel::spanned(quint32 row) const
+{
+	return (row < QTerminalModel::numberOfRows and QTerminalModel::entry(row).ratio == 0u);
+}
+
+void QTerminalModel::spillIncoming(const HexTerminalFile* files, quint32 count)
+{
+	if (QTerminalModel::spill.isOpen())
+		QTerminalModel::spill.write(reinterpret_cast<const char*>(files), static_cast<qint64>(count)*static_cast<qint64>(sizeof(HexTerminalFile)));
+	
+	QTerminalModel::numberOfSpilledRows += count;
+	QTerminalModel::numberOfRows += count;
+}
+
+void QTerminalModel::spillResident(quint32 count)
+{
+	while (count != 0u)
+	{
+		const auto start = QTerminalModel::numberOfSpilledRows % QTerminalModel::Capacity;
+		const auto chunk = std::min(count, QTerminalModel::Capacity - start);
+		
+		if (QTerminalModel::spill.isOpen())
+			QTerminalModel::spill.write(reinterpret_cast<const char*>(QTerminalModel::logs.data() + start), static_cast<qint64>(chunk)*static_cast<qint64>(sizeof(HexTerminalFile)));
+		
+		QTerminalModel::numberOfSpilledRows += chunk;
+		count -= chunk;
+	}
+}
+
+QString QTerminalModel::text(quint32 row, qint32 column) const
+{
+	if (QTerminalModel::numberOfRows != row)
+	{
+		const auto& file = QTerminalModel::entry(row);
 		
 		switch (column)
 		{
@@ -173,6 +332,9 @@ QVariant QTerminalModel::retrieveData(const QModelIndex& index) const
 			case 2:
 				return QString::number(file.volatility, 'f', 2);
 			
+			case 3:
+				return file.instrumentName();
+			
 			case 4:
 				return QString::number(file.worstSimilarity, 'f', 3);
 			
@@ -182,7 +344,7 @@ QVariant QTerminalModel::retrieveData(const QModelIndex& index) const
 			case 7:
 			{
 				if (file.ratio == 0u)
-					return file.buy;
+					return QTerminalModel::BestsString(file.buys, file.numberOfBests);
 				
 				
 				return QString("[70%] ") + (file.buy70 != 0.f ? QString::number(file.buy70, 'f', 2) : QString("---------"));
@@ -191,7 +353,7 @@ QVariant QTerminalModel::retrieveData(const QModelIndex& index) const
 			case 8:
 			{
 				if (file.ratio == 0u)
-					return QVariant();
+					return QString();
 				
 				
 				return QString("[80%] ") + (file.buy80 != 0.f ? QString::number(file.buy80, 'f', 2) : QString("---------"));
@@ -200,7 +362,7 @@ QVariant QTerminalModel::retrieveData(const QModelIndex& index) const
 			case 9:
 			{
 				if (file.ratio == 0u)
-					return QVariant();
+					return QString();
 				
 				
 				return QString("[90%] ") + (file.buy90 != 0.f ? QString::number(file.buy90, 'f', 2) : QString("---------"));
@@ -212,7 +374,7 @@ QVariant QTerminalModel::retrieveData(const QModelIndex& index) const
 			case 11:
 			{
 				if (file.ratio == 0u)
-					return file.sell;
+					return QTerminalModel::BestsString(file.sells, file.numberOfBests);
 				
 				
 				return QString("[70%] ") + (file.sell70 != 0.f ? QString::number(file.sell70, 'f', 2) : QString("---------"));
@@ -221,7 +383,7 @@ QVariant QTerminalModel::retrieveData(const QModelIndex& index) const
 			case 12:
 			{
 				if (file.ratio == 0u)
-					return QVariant();
+					return QString();
 				
 				
 				return QString("[80%] ") + (file.sell80 != 0.f ? QString::number(file.sell80, 'f', 2) : QString("---------"));
@@ -230,7 +392,7 @@ QVariant QTerminalModel::retrieveData(const QModelIndex& index) const
 			case 13:
 			{
 				if (file.ratio == 0u)
-					return QVariant();
+					return QString();
 				
 				
 				return QString("[90%] ") + (file.sell90 != 0.f ? QString::number(file.sell90, 'f', 2) : QString("---------"));
@@ -238,83 +400,7 @@ QVariant QTerminalModel::retrieveData(const QModelIndex& index) const
 		}
 	}
 	
-	return QVariant();
-}
-
-QVariant QTerminalModel::retrieveForeground(const QModelIndex& index) const
-{
-	const auto row = static_cast<quint32>(index.row());
-	
-	if (QTerminalModel::logs.size() != row)
-	{
-		const auto column = index.column();
-		
-		if (column < 4 or column == 6)
-			return QColor(Qt::white);
-		
-		const auto& file = QTerminalModel::logs[row];
-		
-		switch (column)
-		{
-			case 4:
-				return (file.worstSimilarity >= QTerminalModel::threshold ? QColor(135, 215, 0) : QColor(255, 175, 0));
-			
-			case 5:
-				return (file.numberOfSamples >= QTerminalModel::numberOfCandidates ? QColor(135, 215, 0) : QColor(255, 175, 0));
-			
-			case 7:
-				return (file.ratio == 0u or file.buy70 < QTerminalModel::takeProfit ? QColor(95, 215, 255) : QColor(Qt::white));
-			
-			case 8:
-				return (file.ratio == 0u or file.buy80 < QTerminalModel::takeProfit ? QColor(95, 215, 255) : QColor(Qt::white));
-			
-			case 9:
-				return (file.ratio == 0u or file.buy90 < QTerminalModel::takeProfit ? QColor(95, 215, 255) : QColor(Qt::white));
-			
-			case 10:
-			{
-				switch (file.ratio/1'000u)
-				{
-					case 1u:
-						return QColor(95, 215, 255);
-					
-					case 2u:
-						return QColor(188, 188, 188);
-					
-					case 3u:
-						return QColor(255, 95, 0);
-				}
-				
-				break;
-			}
-			
-			case 11:
-				return (file.ratio == 0u or file.sell70 < QTerminalModel::takeProfit ? QColor(255, 95, 0) : QColor(Qt::white));
-			
-			case 12:
-				return (file.ratio == 0u or file.sell80 < QTerminalModel::takeProfit ? QColor(255, 95, 0) : QColor(Qt::white));
-			
-			case 13:
-				return (file.ratio == 0u or file.sell90 < QTerminalModel::takeProfit ? QColor(255, 95, 0) : QColor(Qt::white));
-		}
-	}
-	
-	return QVariant();
-}
-
-qint32 QTerminalModel::rowCount(const QModelIndex&) const
-{
-	return static_cast<qint32>(QTerminalModel::logs.size()) + 1;
-}
-
-void QTerminalModel::setUp(quint32 p, quint32 nc, qreal th, qreal tp)
-{
-	QTerminalModel::logs.clear();
-
-	QTerminalModel::period = p;
-	QTerminalModel::numberOfCandidates = nc;
-	QTerminalModel::threshold = static_cast<qreal>(th);
-	QTerminalModel::takeProfit = static_cast<qreal>(tp);
+	return QString();
 }
 
 QString QTerminalModel::TimeString(quint32 timestamp)
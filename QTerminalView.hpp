@@ -0,0 +1,222 @@
+#ifndef __TERMINAL_VIEW_HPP__
+#define __TERMINAL_VIEW_HPP__
+
+// Qt Libraries
+#include <QAbstractScrollArea>
+#include <QFontMetrics>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QResizeEvent>
+#include <QScrollBar>
+#include <QStaticText>
+
+// Standard Libraries
+#include <algorithm>
+#include <array>
+
+// Personal Libraries
+#include "QTerminalModel.hpp"
+
+class QTerminalView : public QAbstractScrollArea
+{
+	Q_OBJECT
+	
+	private:
+	
+		static constexpr std::array<qint32, 14u>	Widths = { 80, 50, 50, 40, 60, 35, 19, 140, 140, 140, 35, 140, 140, 140 };
+		static constexpr qint32				RowHeight = 20;
+		static constexpr qint32				Padding = 4;
+		static constexpr qint32				SpanWidth = 3;
+		static constexpr quint32			CacheSize = 256u;
+		
+		const QTerminalModel&				model;
+		std::array<qint32, 15u>				offsets;
+		std::vector<std::array<QStaticText, 14u>>	cachedTexts;
+		std::vector<quint32>				cachedRows;
+		qint32						advance = 0;
+		qint32						textTop = 0;
+		quint32						numberOfRows = 0u;
+		
+		inline const std::array<QStaticText, 14u>&	layout(quint32);
+		inline qint32					numberOfVisibleRows(void) const;
+		inline void					paintRow(QPainter&, quint32, qint32);
+		inline void					updateRange(void);
+	
+	protected:
+	
+		inline void					paintEvent(QPaintEvent*) override;
+		inline void					resizeEvent(QResizeEvent*) override;
+		inline void					scrollContentsBy(qint32, qint32) override;
+	
+	public:
+	
+		inline						QTerminalView(const QTerminalModel&, QWidget*);
+		inline void					append(void);
+		inline void					reset(void);
+		inline void					setTerminalFont(const QFont&);
+};
+
+QTerminalView::QTerminalView(const QTerminalModel& foo, QWidget* parent) :
+	QAbstractScrollArea(parent),
+	model(foo),
+	cachedTexts(QTerminalView::CacheSize),
+	cachedRows(QTerminalView::CacheSize, ~0u)
+{
+	QTerminalView::offsets[0u] = 0;
+	
+	for (auto i = 0u; i < QTerminalView::Widths.size(); ++i)
+		QTerminalView::offsets[i + 1u] = QTerminalView::offsets[i] + QTerminalView::Widths[i];
+	
+	for (auto& texts : QTerminalView::cachedTexts)
+	{
+		for (auto& text : texts)
+		{
+			text.setTextFormat(Qt::PlainText);
+			text.setPerformanceHint(QStaticText::AggressiveCaching);
+		}
+	}
+	
+	QAbstractScrollArea::setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+	QAbstractScrollArea::viewport()->setAttribute(Qt::WA_OpaquePaintEvent);
+	QAbstractScrollArea::verticalScrollBar()->setSingleStep(1);
+}
+
+void QTerminalView::append(void)
+{
+	const auto scrollBar = QAbstractScrollArea::verticalScrollBar();
+	const auto following = (scrollBar->value() == scrollBar->maximum());
+	const auto previous = QTerminalView::numberOfRows;
+	
+	QTerminalView::numberOfRows = QTerminalView::model.rowCount();
+	QTerminalView::updateRange();
+	
+	if (following)
+		scrollBar->setValue(scrollBar->maximum());
+	
+	const auto top = std::max(static_cast<qint32>(previous) - scrollBar->value(), 0)*QTerminalView::RowHeight;
+	
+	if (top < QAbstractScrollArea::viewport()->height())
+		QAbstractScrollArea::viewport()->update(QRect(0, top, QAbstractScrollArea::viewport()->width(), QAbstractScrollArea::viewport()->height() - top));
+}
+
+// Rows never change once appended, so each one is formatted and laid out once and then redrawn from
+// the cache while it stays on screen; the ring is larger than any viewport.
+const std::array<QStaticText, 14u>& QTerminalView::layout(quint32 row)
+{
+	const auto slot = row % QTerminalView::CacheSize;
+	auto& texts = QTerminalView::cachedTexts[slot];
+	
+	if (QTerminalView::cachedRows[slot] == row)
+		return texts;
+	
+	for (auto column = 0u; column < texts.size(); ++column)
+	{
+		texts[column].setText(QTerminalView::model.text(row, static_cast<qint32>(column)));
+		texts[column].prepare(QTransform(), QWidget::font());
+	}
+	
+	QTerminalView::cachedRows[slot] = row;
+	return texts;
+}
+
+qint32 QTerminalView::numberOfVisibleRows(void) const
+{
+	return QAbstractScrollArea::viewport()->height()/QTerminalView::RowHeight;
+}
+
+void QTerminalView::paintEvent(QPaintEvent* event)
+{
+	QPainter painter(QAbstractScrollArea::viewport());
+	painter.setFont(QWidget::font());
+	
+	const auto& area = event->rect();
+	const auto first = QAbstractScrollArea::verticalScrollBar()->value();
+	const auto top = area.top()/QTerminalView::RowHeight;
+	const auto bottom = area.bottom()/QTerminalView::RowHeight;
+	
+	for (auto i = top; i <= bottom; ++i)
+	{
+		const auto row = static_cast<quint32>(first + i);
+		const auto y = i*QTerminalView::RowHeight;
+		
+		if (row > QTerminalView::numberOfRows)
+			painter.fillRect(QRect(0, y, QAbstractScrollArea::viewport()->width(), QTerminalView::RowHeight), QColor(Qt::black));
+		else
+			QTerminalView::paintRow(painter, row, y);
+	}
+}
+
+void QTerminalView::paintRow(QPainter& painter, quint32 row, qint32 y)
+{
+	const auto spanned = QTerminalView::model.spanned(row);
+	const auto width = QAbstractScrollArea::viewport()->width();
+	const auto texts = (row != QTerminalView::numberOfRows ? &QTerminalView::layout(row) : nullptr);
+	
+	painter.fillRect(QRect(QTerminalView::offsets.back(), y, std::max(width - QTerminalView::offsets.back(), 0), QTerminalView::RowHeight), QTerminalView::model.background(row, 0));
+	
+	for (auto column = 0; column < static_cast<qint32>(QTerminalView::Widths.size()); ++column)
+	{
+		const auto span = (spanned and (column == 7 or column == 11) ? QTerminalView::SpanWidth : 1);
+		const auto left = QTerminalView::offsets[column];
+		const auto cellWidth = QTerminalView::offsets[column + span] - left;
+		
+		painter.fillRect(QRect(left, y, cellWidth, QTerminalView::RowHeight), QTerminalView::model.background(row, column));
+		
+		if (texts != nullptr)
+		{
+			const auto& text = (*texts)[column];
+			const auto length = static_cast<qint32>(text.text().size());
+			
+			if (length != 0)
+			{
+				const auto x = (QTerminalView::model.leftAligned(column) ? left + QTerminalView::Padding : left + (cellWidth - length*QTerminalView::advance)/2);
+				
+				painter.setPen(QTerminalView::model.foreground(row, column));
+				painter.drawStaticText(x, y + QTerminalView::textTop, text);
+			}
+		}
+		
+		column += span - 1;
+	}
+}
+
+void QTerminalView::reset(void)
+{
+	std::fill(QTerminalView::cachedRows.begin(), QTerminalView::cachedRows.end(), ~0u);
+	QTerminalView::numberOfRows = 0u;
+	QTerminalView::updateRange();
+	QAbstractScrollArea::verticalScrollBar()->setValue(0);
+	QAbstractScrollArea::viewport()->update();
+}
+
+void QTerminalView::resizeEvent(QResizeEvent* event)
+{
+	QAbstractScrollArea::resizeEvent(event);
+	QTerminalView::updateRange();
+}
+
+void QTerminalView::scrollContentsBy(qint32, qint32 dy)
+{
+	QAbstractScrollArea::viewport()->scroll(0, dy*QTerminalView::RowHeight);
+}
+
+void QTerminalView::setTerminalFont(const QFont& monospace)
+{
+	const QFontMetrics metrics(monospace);
+	
+	QWidget::setFont(monospace);
+	std::fill(QTerminalView::cachedRows.begin(), QTerminalView::cachedRows.end(), ~0u);
+	QTerminalView::advance = metrics.horizontalAdvance(QChar('0'));
+	QTerminalView::textTop = (QTerminalView::RowHeight - metrics.ascent() - metrics.descent())/2;
+}
+
+void QTerminalView::updateRange(void)
+{
+	const auto visible = QTerminalView::numberOfVisibleRows();
+	const auto scrollBar = QAbstractScrollArea::verticalScrollBar();
+	
+	scrollBar->setPageStep(visible);
+	scrollBar->setRange(0, std::max(static_cast<qint32>(QTerminalView::numberOfRows) + 1 - visible, 0));
+}
+
+#endif
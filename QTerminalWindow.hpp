@@ -3,12 +3,15 @@
 
 // Qt Libraries
 #include <QFontDatabase>
-#include <QHeaderView>
 #include <QMainWindow>
-#include <QTableView>
+#include <QTimer>
+
+// Standard Libraries
+#include <iostream>
 
 // Personal Libraries
-#include "QTerminalModel.hpp"
+#include "HexRowQueue.hpp"
+#include "QTerminalView.hpp"
 
 class QTerminalWindow : public QMainWindow
 {
@@ -16,17 +19,24 @@ class QTerminalWindow : public QMainWindow
 	
 	private:
 	
-		QTableView* const	terminal = new QTableView(this);
-		QTerminalModel		model;
+		static constexpr quint32			BatchSize = 4'096u;
+		static constexpr qint32				DisplayInterval = 16;
+		
+		QTerminalModel					model;
+		QTerminalView* const				terminal = new QTerminalView(QTerminalWindow::model, this);
+		QTimer* const					timer = new QTimer(this);
+		std::vector<HexRowQueue<HexTerminalFile>*>	queues;
+		std::vector<HexTerminalFile>			batch;
 	
 	private slots:
 	
-		inline void		updateTable(HexTerminalFile*);
+		inline void					updateTable(void);
 	
 	public:
 	
-		inline			QTerminalWindow(QWidget*);
-		inline void		setUp(quint32, quint32, qreal, qreal);
+		inline						QTerminalWindow(QWidget*);
+		inline void					attach(HexRowQueue<HexTerminalFile>&);
+		inline void					setUp(quint32, quint32, qreal, qreal);
 };
 
 QTerminalWindow::QTerminalWindow(QWidget* parent) : QMainWindow(parent)
@@ -38,56 +48,51 @@ QTerminalWindow::QTerminalWindow(QWidget* parent) : QMainWindow(parent)
 	const auto family = QFontDatabase::applicationFontFamilies(id).at(0);
 	QFont monospace(family, 13);
 	
-	QTerminalWindow::terminal->setFont(monospace);
+	QTerminalWindow::terminal->setTerminalFont(monospace);
 	QTerminalWindow::terminal->setObjectName("Black");
 	
-	QTerminalWindow::terminal->setModel(nullptr);
-	QTerminalWindow::terminal->reset();
-	QTerminalWindow::terminal->setModel(&(QTerminalWindow::model));
-	
-	const auto header1 = QTerminalWindow::terminal->horizontalHeader();
-	header1->setMinimumSectionSize(5);
-	header1->resizeSection(0, 80);
-	header1->resizeSection(1, 50);
-	header1->resizeSection(2, 50);
-	header1->resizeSection(3, 19);
-	header1->resizeSection(4, 60);
-	header1->resizeSection(5, 35);
-	header1->resizeSection(6, 19);
-	header1->resizeSection(7, 140);
-	header1->resizeSection(8, 140);
-	header1->resizeSection(9, 140);
-	header1->resizeSection(10, 35);
-	header1->resizeSection(11, 140);
-	header1->resizeSection(12, 140);
-	header1->resizeSection(13, 140);
-	header1->hide();
-	
-	const auto header2 = QTerminalWindow::terminal->verticalHeader();
-	header2->setMinimumSectionSize(5);
-	header2->setDefaultSectionSize(20);
-	header2->hide();
+	QTerminalWindow::batch.resize(QTerminalWindow::BatchSize);
+	QObject::connect(QTerminalWindow::timer, SIGNAL(timeout(void)), this, SLOT(updateTable(void)));
+	QTerminalWindow::timer->start(QTerminalWindow::DisplayInterval);
+}
+
+void QTerminalWindow::attach(HexRowQueue<HexTerminalFile>& queue)
+{
+	QTerminalWindow::queues.push_back(&queue);
 }
 
 void QTerminalWindow::setUp(quint32 p, quint32 nc, qreal th, qreal tp)
 {
+	for (const auto queue : QTerminalWindow::queues)
+		queue->clear();
+	
 	QTerminalWindow::model.setUp(p, nc, th, tp);
-	QTerminalWindow::terminal->setSpan(0, 0, 1, 14);
+	QTerminalWindow::terminal->reset();
 }
 
-void QTerminalWindow::updateTable(HexTerminalFile* foo)
+void QTerminalWindow::updateTable(void)
 {
-	const auto size = QTerminalWindow::model.process(foo);
-	const auto index = QTerminalWindow::model.index(size, 0);
+	auto appended = false;
 	
-	if (foo->ratio == 0u)
+	for (const auto queue : QTerminalWindow::queues)
 	{
-		QTerminalWindow::terminal->setSpan(size, 7, 1, 3);
-		QTerminalWindow::terminal->setSpan(size, 11, 1, 3);
+		const auto drops = queue->takeDrops();
+		
+		if (drops != 0u)
+			std::cout << " >> Terminal dropped " << drops << " rows." << std::endl;
+		
+		auto count = queue->pop(QTerminalWindow::batch.data(), QTerminalWindow::BatchSize);
+		
+		while (count != 0u)
+		{
+			QTerminalWindow::model.process(QTerminalWindow::batch.data(), count);
+			appended = true;
+			count = queue->pop(QTerminalWindow::batch.data(), QTerminalWindow::BatchSize);
+		}
 	}
 	
-	QTerminalWindow::terminal->scrollTo(index, QAbstractItemView::PositionAtBottom);
-	delete foo;
+	if (appended)
+		QTerminalWindow::terminal->append();
 }
 
 #endif